@@ -26,7 +26,8 @@ public class ModularFeatures_ExtraActions : ModuleRules
 			"GameplayTags",
 			"GameFeatures",
 			"ModularGameplay",
-			"DeveloperSettings"
+			"DeveloperSettings",
+			"Json"
 		});
 	}
 }
\ No newline at end of file
@@ -0,0 +1,356 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#include "Actions/GameFeatureAction_AddAbilities.h"
+#include "ModularFeatures_InternalFuncs.h"
+#include "MFEA_EventLog.h"
+#include "MFEA_Stats.h"
+#include <Engine/GameInstance.h>
+#include <InputAction.h>
+#include <UObject/ObjectSaveContext.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GameFeatureAction_AddAbilities)
+#endif
+
+DECLARE_CYCLE_STAT(TEXT("Reset Abilities"), STAT_MFEA_AddAbilities_Reset, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Add Abilities"), STAT_MFEA_AddAbilities_Add, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Remove Abilities"), STAT_MFEA_AddAbilities_Remove, STATGROUP_MFEA);
+
+void UGameFeatureAction_AddAbilities::OnGameFeatureActivating(FGameFeatureActivatingContext& Context)
+{
+	if (!ensureAlways(ActiveExtensions.IsEmpty()))
+	{
+		ResetExtension();
+	}
+
+	// Compile the tags before any actor is extended, the filter is checked for every addition event
+	RequireTagsFilter.Compile(RequireTags);
+
+	Super::OnGameFeatureActivating(Context);
+}
+
+void UGameFeatureAction_AddAbilities::OnGameFeatureDeactivating(FGameFeatureDeactivatingContext& Context)
+{
+	Super::OnGameFeatureDeactivating(Context);
+	ResetExtension();
+}
+
+void UGameFeatureAction_AddAbilities::ResetExtension()
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_AddAbilities_Reset, this, nullptr);
+
+	// Tear down all records in a single pass instead of removing one actor at a time
+	ActiveExtensions.Reset([this](AActor* const Owner, FActiveAbilityData& ActiveAbilities)
+	{
+		if (IsValid(Owner) && Owner->GetLocalRole() == ROLE_Authority)
+		{
+			RemoveActorAbilities(Owner, ActiveAbilities);
+		}
+	});
+
+	CompiledInputIDs.Empty();
+
+	Super::ResetExtension();
+}
+
+int32 UGameFeatureAction_AddAbilities::GetNumExtendedActors() const
+{
+	return ActiveExtensions.Num();
+}
+
+void UGameFeatureAction_AddAbilities::AddToWorld(const FWorldContext& WorldContext)
+{
+	AddExtensionHandler(WorldContext, TargetPawnClass);
+}
+
+void UGameFeatureAction_AddAbilities::GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const
+{
+	for (const FAbilityMapping& Entry : Abilities)
+	{
+		ModularFeaturesHelper::AddSoftReferenceToPreload(OutAssets, Entry.AbilityClass);
+		ModularFeaturesHelper::AddSoftReferenceToPreload(OutAssets, Entry.InputAction);
+	}
+
+	if (ModularFeaturesHelper::IsUsingInputIDEnumeration() && !HasBakedInputIDs())
+	{
+		ModularFeaturesHelper::AddSoftReferenceToPreload(OutAssets, ModularFeaturesHelper::GetPluginSettings()->InputIDEnumeration);
+	}
+}
+
+void UGameFeatureAction_AddAbilities::OnAssetsPreloaded()
+{
+	Super::OnAssetsPreloaded();
+	CompileInputIDs();
+}
+
+void UGameFeatureAction_AddAbilities::PreSave(const FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	// The editor data always resolves the InputIDs on activation
+	BakedInputIDs.Reset();
+
+	if (SaveContext.IsCooking())
+	{
+		for (const FAbilityMapping& Entry : Abilities)
+		{
+			BakedInputIDs.Add(ModularFeaturesHelper::GetInputIDByName(Entry.InputIDValueName));
+		}
+	}
+}
+
+#if WITH_EDITOR
+void UGameFeatureAction_AddAbilities::ValidateActionData(TArray<FText>& OutErrors) const
+{
+	Super::ValidateActionData(OutErrors);
+	ValidateRequiredTags(RequireTags, OutErrors);
+
+	for (int32 Index = 0; Index < Abilities.Num(); ++Index)
+	{
+		const FAbilityMapping& Entry = Abilities[Index];
+
+		if (Entry.AbilityClass.IsNull())
+		{
+			OutErrors.Add(FText::FromString(FString::Printf(TEXT("Ability Mapping %d: Ability class is null."), Index)));
+		}
+
+		// The InputID is only used to bind the input of the ability
+		const bool bRequiresInputID = ModularFeaturesHelper::IsUsingInputIDEnumeration() && !Entry.InputAction.IsNull();
+		if (bRequiresInputID && ModularFeaturesHelper::GetInputIDByName(Entry.InputIDValueName) == INDEX_NONE)
+		{
+			OutErrors.Add(FText::FromString(FString::Printf(TEXT("Ability Mapping %d: InputID Value Name %s not found in the InputID Enumeration."),
+			                                                Index, *Entry.InputIDValueName.ToString())));
+		}
+	}
+}
+#endif
+
+bool UGameFeatureAction_AddAbilities::HasBakedInputIDs() const
+{
+#if WITH_EDITOR
+	return false;
+#else
+	return BakedInputIDs.Num() == Abilities.Num();
+#endif
+}
+
+void UGameFeatureAction_AddAbilities::CompileInputIDs()
+{
+	if (HasBakedInputIDs())
+	{
+		CompiledInputIDs = BakedInputIDs;
+		return;
+	}
+
+	CompiledInputIDs.Empty(Abilities.Num());
+
+	// If InputID Enumeration using is disabled, assume -1 as value
+	for (const FAbilityMapping& Entry : Abilities)
+	{
+		CompiledInputIDs.Add(ModularFeaturesHelper::GetInputIDByName(Entry.InputIDValueName));
+	}
+}
+
+void UGameFeatureAction_AddAbilities::HandleActorExtension(const FMFEA_ExtensionContext& Context)
+{
+	if (Context.IsRemovalEvent())
+	{
+		QueueExtensionWork(Context, EExtensionWorkType::Remove);
+	}
+
+	else if (Context.IsAdditionEvent())
+	{
+		// We don't want to repeat the addition and cannot add if the user don't have the required tags
+		if (!IsValid(Context.GetActor()) || ActiveExtensions.Contains(Context.GetActor()) || !RequireTagsFilter.Matches(Context.ActorTags))
+		{
+			return;
+		}
+
+		QueueExtensionWork(Context, EExtensionWorkType::Add);
+	}
+}
+
+void UGameFeatureAction_AddAbilities::ProcessExtensionWork(const FMFEA_ExtensionContext& Context, const EExtensionWorkType WorkType)
+{
+	if (WorkType == EExtensionWorkType::Remove)
+	{
+		RemoveActorAbilities(Context.GetActor());
+		return;
+	}
+
+	// The actor may have been extended while this addition was waiting in the queue
+	if (ActiveExtensions.Contains(Context.GetActor()))
+	{
+		return;
+	}
+
+	// Given after the attributes and effects added to the actor by the other actions
+	Context.ExecuteInTransaction(FMFEA_AbilitySystemTransaction::EPhase::Abilities, [WeakThis = TWeakObjectPtr<ThisClass>(this), Context]
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->ExtendActorAbilities(Context);
+		}
+	});
+}
+
+void UGameFeatureAction_AddAbilities::ExtendActorAbilities(const FMFEA_ExtensionContext& Context)
+{
+	TArray<FMFEA_AbilityBindingEntry> NewBindings;
+	AddActorAbilities(Context, NewBindings);
+
+	// Send the inputs of all given abilities to the target Ability Input Binding interface with a single call
+	if (!NewBindings.IsEmpty())
+	{
+		UObject* const SetupInputInterface = ModularFeaturesHelper::GetAbilityInputBindingOwner(Context.GetActor(), InputBindingOwnerOverride);
+
+		// If we can bind the inputs to the target interface, we must add the input references to the ability data
+		if (FActiveAbilityData* const AbilityData = ActiveExtensions.Find(Context.GetActor());
+			AbilityData && ModularFeaturesHelper::BindAbilityInputsToInterfaceOwner(SetupInputInterface, NewBindings))
+		{
+			for (const FMFEA_AbilityBindingEntry& Binding : NewBindings)
+			{
+				AbilityData->InputReference.Add(Binding.Action);
+			}
+		}
+	}
+}
+
+void UGameFeatureAction_AddAbilities::AddActorAbilities(const FMFEA_ExtensionContext& Context, TArray<FMFEA_AbilityBindingEntry>& OutBindings)
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_AddAbilities_Add, this, Context.GetActor());
+
+	// Only proceed if the target actor is valid and has authority
+	AActor* const TargetActor = Context.GetActor();
+	if (!IsValid(TargetActor) || !Context.bHasAuthority)
+	{
+		return;
+	}
+
+	// Use the ability system component resolved once for all actions
+	UAbilitySystemComponent* const AbilitySystemComponent = Context.GetAbilitySystemComponent();
+	if (!IsValid(AbilitySystemComponent))
+	{
+		FMFEA_EventLog::Record(EMFEA_EventAction::Abilities, EMFEA_EventKind::Add, TargetActor, nullptr, EMFEA_EventResult::Failed);
+		UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Failed to find AbilitySystemComponent on Actor %s."), *FString(__FUNCTION__),
+		       *TargetActor->GetName());
+		return;
+	}
+
+	// A single record for all abilities of this action, with the handles reserved once
+	FActiveAbilityData& NewAbilityData = ActiveExtensions.FindOrAdd(TargetActor);
+	NewAbilityData.AbilitySystemComponent = AbilitySystemComponent;
+	NewAbilityData.SpecHandle.Reserve(NewAbilityData.SpecHandle.Num() + Abilities.Num());
+	OutBindings.Reserve(OutBindings.Num() + Abilities.Num());
+
+	FMFEA_EventLog::Record(EMFEA_EventAction::Abilities, EMFEA_EventKind::Add, TargetActor, GetOuter());
+
+	// Lock the ability list while giving the abilities: the specs are added and notified together when the lock is released
+	FScopedAbilityListLock AbilityListLock(*AbilitySystemComponent);
+
+	for (int32 Index = 0; Index < Abilities.Num(); ++Index)
+	{
+		const FAbilityMapping& Ability = Abilities[Index];
+		if (Ability.AbilityClass.IsNull())
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Ability class is null."), *FString(__FUNCTION__));
+			continue;
+		}
+
+		// Get the ability class, already resident since the feature activation
+		const TSubclassOf<UGameplayAbility> AbilityToAdd = Ability.AbilityClass.Get();
+		if (!AbilityToAdd)
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Ability class %s is not loaded."), *FString(__FUNCTION__),
+			       *Ability.AbilityClass.ToString());
+			continue;
+		}
+
+		// Create the spec, used to give the ability to target's ability system component
+		const int32 InputID = CompiledInputIDs.IsValidIndex(Index) ? CompiledInputIDs[Index] : INDEX_NONE;
+		const FGameplayAbilitySpec NewAbilitySpec(AbilityToAdd, Ability.AbilityLevel, InputID, TargetActor);
+
+		// Try to give the ability to the target and check if the spec handle is valid
+		if (const FGameplayAbilitySpecHandle NewSpecHandle = AbilitySystemComponent->GiveAbility(NewAbilitySpec); NewSpecHandle.IsValid())
+		{
+			// Add the spec handle to the ability data
+			NewAbilityData.SpecHandle.Add(NewSpecHandle);
+
+			// Only bind the input if the Input Action is valid. This is not mandatory due to passive abilities that don't need to be associated to inputs
+			if (UInputAction* const AbilityInput = Ability.InputAction.Get())
+			{
+				// The bindings are sent to the interface after all abilities are given
+				OutBindings.Add(ModularFeaturesHelper::MakeAbilityBindingEntry(AbilityInput, NewAbilitySpec));
+			}
+		}
+	}
+}
+
+void UGameFeatureAction_AddAbilities::RemoveActorAbilities(AActor* TargetActor)
+{
+	// Only proceed if the target actor is valid
+	if (!IsValid(TargetActor))
+	{
+		ActiveExtensions.Remove(TargetActor);
+		return;
+	}
+
+	// Only proceed if the target actor has authority
+	if (TargetActor->GetLocalRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	// Check if we can remove the abilities from this target actor by checking if it is inside the active extensions map
+	FActiveAbilityData* const ActiveAbilities = ActiveExtensions.Find(TargetActor);
+	if (!ActiveAbilities)
+	{
+		UE_LOG(LogGameplayFeaturesExtraActions_Internal, Warning, TEXT("%s: No active abilities found for Actor %s."), *FString(__FUNCTION__),
+		       *TargetActor->GetName());
+
+		return;
+	}
+
+	RemoveActorAbilities(TargetActor, *ActiveAbilities);
+	ActiveExtensions.Remove(TargetActor);
+}
+
+void UGameFeatureAction_AddAbilities::RemoveActorAbilities(AActor* TargetActor, FActiveAbilityData& ActiveAbilities)
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_AddAbilities_Remove, this, TargetActor);
+
+	// Use the ability system component that received the abilities
+	if (UAbilitySystemComponent* const AbilitySystemComponent = ActiveAbilities.AbilitySystemComponent.Get())
+	{
+		FMFEA_EventLog::Record(EMFEA_EventAction::Abilities, EMFEA_EventKind::Remove, TargetActor, GetOuter());
+
+		{
+			// Lock the ability list so all removals are applied together when the lock is released
+			FScopedAbilityListLock AbilityListLock(*AbilitySystemComponent);
+
+			// Iterate the active abilities and remove all spec handle associated to this actor
+			for (const FGameplayAbilitySpecHandle& SpecHandle : ActiveAbilities.SpecHandle)
+			{
+				if (SpecHandle.IsValid())
+				{
+					// Set the ability to be removed on end and clear it
+					AbilitySystemComponent->SetRemoveAbilityOnEnd(SpecHandle);
+					AbilitySystemComponent->ClearAbility(SpecHandle);
+				}
+			}
+		}
+
+		// Get the interface owner and try to remove the input bindings
+		if (UObject* const SetupInputInterface = ModularFeaturesHelper::GetAbilityInputBindingOwner(TargetActor, InputBindingOwnerOverride))
+		{
+			ModularFeaturesHelper::RemoveAbilityInputInInterfaceOwner(SetupInputInterface, ActiveAbilities.InputReference);
+		}
+	}
+	else if (IsValid(GetWorld()) && IsValid(GetWorld()->GetGameInstance()))
+	{
+		UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Failed to find AbilitySystemComponent on Actor %s."), *FString(__FUNCTION__),
+		       *TargetActor->GetName());
+	}
+}
@@ -0,0 +1,324 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#include "Actions/GameFeatureAction_AddAttribute.h"
+#include "ModularFeatures_InternalFuncs.h"
+#include "MFEA_EventLog.h"
+#include "MFEA_Stats.h"
+#include <Engine/GameInstance.h>
+#include <Engine/DataTable.h>
+#include <Runtime/Launch/Resources/Version.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GameFeatureAction_AddAttribute)
+#endif
+
+DECLARE_CYCLE_STAT(TEXT("Reset Attributes"), STAT_MFEA_AddAttribute_Reset, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Add Attribute"), STAT_MFEA_AddAttribute_Add, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Remove Attribute"), STAT_MFEA_AddAttribute_Remove, STATGROUP_MFEA);
+
+void UGameFeatureAction_AddAttribute::OnGameFeatureActivating(FGameFeatureActivatingContext& Context)
+{
+	if (!ensureAlways(ActiveExtensions.IsEmpty()))
+	{
+		ResetExtension();
+	}
+
+	// Compile the tags before any actor is extended, the filter is checked for every addition event
+	RequireTagsFilter.Compile(RequireTags);
+
+	Super::OnGameFeatureActivating(Context);
+}
+
+void UGameFeatureAction_AddAttribute::OnGameFeatureDeactivating(FGameFeatureDeactivatingContext& Context)
+{
+	Super::OnGameFeatureDeactivating(Context);
+	ResetExtension();
+}
+
+void UGameFeatureAction_AddAttribute::ResetExtension()
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_AddAttribute_Reset, this, nullptr);
+
+	// Tear down all records in a single pass instead of removing one actor at a time
+	ActiveExtensions.Reset([this](AActor* const Owner, const TWeakObjectPtr<UAttributeSet>& AttributeSet)
+	{
+		if (IsValid(Owner) && Owner->GetLocalRole() == ROLE_Authority)
+		{
+			RemoveAttribute(Owner, AttributeSet.Get());
+		}
+	});
+
+	CompiledInitialization.Empty();
+	bUseCompiledInitialization = false;
+
+	Super::ResetExtension();
+}
+
+int32 UGameFeatureAction_AddAttribute::GetNumExtendedActors() const
+{
+	return ActiveExtensions.Num();
+}
+
+void UGameFeatureAction_AddAttribute::AddToWorld(const FWorldContext& WorldContext)
+{
+	AddExtensionHandler(WorldContext, TargetPawnClass);
+}
+
+void UGameFeatureAction_AddAttribute::GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const
+{
+	ModularFeaturesHelper::AddSoftReferenceToPreload(OutAssets, Attribute);
+	ModularFeaturesHelper::AddSoftReferenceToPreload(OutAssets, InitializationData);
+}
+
+void UGameFeatureAction_AddAttribute::OnAssetsPreloaded()
+{
+	Super::OnAssetsPreloaded();
+	CompileInitializationData();
+}
+
+#if WITH_EDITOR
+void UGameFeatureAction_AddAttribute::ValidateActionData(TArray<FText>& OutErrors) const
+{
+	Super::ValidateActionData(OutErrors);
+	ValidateRequiredTags(RequireTags, OutErrors);
+
+	if (Attribute.IsNull())
+	{
+		OutErrors.Add(FText::FromString(TEXT("Attribute class is null.")));
+	}
+}
+#endif
+
+void UGameFeatureAction_AddAttribute::CompileInitializationData()
+{
+	CompiledInitialization.Reset();
+	bUseCompiledInitialization = false;
+
+	const UClass* const SetType = Attribute.Get();
+	const UDataTable* const InitializationTable = InitializationData.Get();
+	if (!IsValid(SetType) || !IsValid(InitializationTable))
+	{
+		return;
+	}
+
+	// Only native classes can override InitFromMetaDataTable: without the user confirmation, we keep calling it unless the class is a Blueprint of UAttributeSet
+	const UClass* NativeSetType = SetType;
+	while (NativeSetType && !NativeSetType->HasAnyClassFlags(CLASS_Native))
+	{
+		NativeSetType = NativeSetType->GetSuperClass();
+	}
+
+	if (!bPrecompileInitializationData && NativeSetType != UAttributeSet::StaticClass())
+	{
+		return;
+	}
+
+	bUseCompiledInitialization = true;
+
+	static const FString Context = FString(__FUNCTION__);
+
+	// Same matching used by UAttributeSet::InitFromMetaDataTable, but performed only once: each row named Class.Property is resolved to the property offset
+	for (TFieldIterator<FProperty> PropertyIt(SetType, EFieldIteratorFlags::IncludeSuper); PropertyIt; ++PropertyIt)
+	{
+		FProperty* const Property = *PropertyIt;
+
+		FNumericProperty* const NumericProperty = CastField<FNumericProperty>(Property);
+		if (!NumericProperty && !FGameplayAttribute::IsGameplayAttributeDataProperty(Property))
+		{
+			continue;
+		}
+
+		const FString RowName = FString::Printf(TEXT("%s.%s"), *Property->GetOwnerVariant().GetName(), *Property->GetName());
+		if (const FAttributeMetaData* const MetaData = InitializationTable->FindRow<FAttributeMetaData>(FName(*RowName), Context, false))
+		{
+			CompiledInitialization.Add({NumericProperty, Property->GetOffset_ForInternal(), MetaData->BaseValue});
+		}
+	}
+
+	UE_LOG(LogGameplayFeaturesExtraActions_Internal, Display, TEXT("%s: Compiled %d initialization values from %s to Attribute %s."),
+	       *FString(__FUNCTION__), CompiledInitialization.Num(), *InitializationTable->GetName(), *SetType->GetName());
+}
+
+void UGameFeatureAction_AddAttribute::InitializeAttributeSet(UAttributeSet* AttributeSet) const
+{
+	if (!bUseCompiledInitialization)
+	{
+		// Let the AttributeSet apply its own initialization. The DataTable is already resident since the feature activation
+		if (const UDataTable* const InitializationTable = InitializationData.Get())
+		{
+			AttributeSet->InitFromMetaDataTable(InitializationTable);
+		}
+
+		return;
+	}
+
+	uint8* const SetData = reinterpret_cast<uint8*>(AttributeSet);
+
+	for (const auto& [NumericProperty, Offset, BaseValue] : CompiledInitialization)
+	{
+		if (NumericProperty)
+		{
+			NumericProperty->SetFloatingPointPropertyValue(SetData + Offset, BaseValue);
+		}
+		else
+		{
+			FGameplayAttributeData* const AttributeData = reinterpret_cast<FGameplayAttributeData*>(SetData + Offset);
+			AttributeData->SetBaseValue(BaseValue);
+			AttributeData->SetCurrentValue(BaseValue);
+		}
+	}
+}
+
+void UGameFeatureAction_AddAttribute::HandleActorExtension(const FMFEA_ExtensionContext& Context)
+{
+	if (Context.IsRemovalEvent())
+	{
+		QueueExtensionWork(Context, EExtensionWorkType::Remove);
+	}
+
+	else if (Context.IsAdditionEvent())
+	{
+		// We don't want to repeat the addition and cannot add if the user don't have the required tags
+		if (!IsValid(Context.GetActor()) || ActiveExtensions.Contains(Context.GetActor()) || !RequireTagsFilter.Matches(Context.ActorTags))
+		{
+			return;
+		}
+
+		QueueExtensionWork(Context, EExtensionWorkType::Add);
+	}
+}
+
+void UGameFeatureAction_AddAttribute::ProcessExtensionWork(const FMFEA_ExtensionContext& Context, const EExtensionWorkType WorkType)
+{
+	if (WorkType == EExtensionWorkType::Remove)
+	{
+		RemoveAttribute(Context.GetActor());
+		return;
+	}
+
+	// The actor may have been extended while this addition was waiting in the queue
+	if (ActiveExtensions.Contains(Context.GetActor()))
+	{
+		return;
+	}
+
+	if (Attribute.IsNull())
+	{
+		UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Attribute is null."), *FString(__FUNCTION__));
+	}
+	else
+	{
+		// Added before the effects and abilities given to the actor by the other actions
+		Context.ExecuteInTransaction(FMFEA_AbilitySystemTransaction::EPhase::Attributes, [WeakThis = TWeakObjectPtr<ThisClass>(this), Context]
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->AddAttribute(Context);
+			}
+		});
+	}
+}
+
+void UGameFeatureAction_AddAttribute::AddAttribute(const FMFEA_ExtensionContext& Context)
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_AddAttribute_Add, this, Context.GetActor());
+
+	// Only proceed if the target actor is valid and has authority
+	AActor* const TargetActor = Context.GetActor();
+	if (!IsValid(TargetActor) || !Context.bHasAuthority)
+	{
+		return;
+	}
+
+	// Get the ability system component of the target actor, resolved once for all actions
+	if (UAbilitySystemComponent* const AbilitySystemComponent = Context.GetAbilitySystemComponent())
+	{
+		// Get the AttributeSet Class, already resident since the feature activation
+		if (const TSubclassOf<UAttributeSet> SetType = Attribute.Get())
+		{
+			// Create the AttributeSet object
+			UAttributeSet* const NewSet = NewObject<UAttributeSet>(AbilitySystemComponent->GetOwnerActor(), SetType);
+
+			// Initialize the AttributeSet using the values of the DataTable. Does nothing if the user didn't set the DataTable
+			InitializeAttributeSet(NewSet);
+
+			// Add the attribute set to the ability system component
+			AbilitySystemComponent->AddAttributeSetSubobject(NewSet);
+
+			// Replicate the attribute addition at the end of the frame, together with the changes of the other actions
+			UMFEA_ExtensionSubsystem::MarkReplicationDirty(AbilitySystemComponent);
+
+			FMFEA_EventLog::Record(EMFEA_EventAction::Attribute, EMFEA_EventKind::Add, TargetActor, SetType);
+
+			ActiveExtensions.FindOrAdd(TargetActor) = NewSet;
+		}
+		else
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Attribute is invalid."), *FString(__FUNCTION__));
+		}
+	}
+	else
+	{
+		FMFEA_EventLog::Record(EMFEA_EventAction::Attribute, EMFEA_EventKind::Add, TargetActor, nullptr, EMFEA_EventResult::Failed);
+		UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Failed to find AbilitySystemComponent on Actor %s."), *FString(__FUNCTION__),
+		       *TargetActor->GetName());
+	}
+}
+
+void UGameFeatureAction_AddAttribute::RemoveAttribute(AActor* TargetActor)
+{
+	// Only proceed if the target actor is valid
+	if (!IsValid(TargetActor))
+	{
+		ActiveExtensions.Remove(TargetActor);
+		return;
+	}
+
+	// Only proceed if the target actor has authority
+	if (TargetActor->GetLocalRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	// Get the added Attribute Set to the target actor by searching inside the Active Extensions
+	if (const TWeakObjectPtr<UAttributeSet>* const ActiveAttribute = ActiveExtensions.Find(TargetActor))
+	{
+		RemoveAttribute(TargetActor, ActiveAttribute->Get());
+	}
+
+	ActiveExtensions.Remove(TargetActor);
+}
+
+void UGameFeatureAction_AddAttribute::RemoveAttribute(AActor* TargetActor, UAttributeSet* AttributeToRemove)
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_AddAttribute_Remove, this, TargetActor);
+
+	// Get the ability system component of the target actor
+	if (UAbilitySystemComponent* const AbilitySystemComponent = ModularFeaturesHelper::GetAbilitySystemComponentInActor(TargetActor))
+	{
+		// Remove the added Attribute Set from the Ability System Component and request a replication
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION == 0
+        if (IsValid(AttributeToRemove) && AbilitySystemComponent->GetSpawnedAttributes_Mutable().Remove(AttributeToRemove) != 0)
+        {
+            FMFEA_EventLog::Record(EMFEA_EventAction::Attribute, EMFEA_EventKind::Remove, TargetActor, AttributeToRemove);
+            UMFEA_ExtensionSubsystem::MarkReplicationDirty(AbilitySystemComponent);
+        }
+#else
+		if (IsValid(AttributeToRemove))
+		{
+			FMFEA_EventLog::Record(EMFEA_EventAction::Attribute, EMFEA_EventKind::Remove, TargetActor, AttributeToRemove);
+
+			AbilitySystemComponent->RemoveSpawnedAttribute(AttributeToRemove);
+			UMFEA_ExtensionSubsystem::MarkReplicationDirty(AbilitySystemComponent);
+		}
+#endif
+	}
+	// We don't need to warn the user if there's no valid world or game instance, since this is a common case when the game is shutting down
+	else if (IsValid(GetWorld()) && IsValid(GetWorld()->GetGameInstance()))
+	{
+		UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Failed to find AbilitySystemComponent on Actor %s."), *FString(__FUNCTION__),
+		       *TargetActor->GetName());
+	}
+}
@@ -0,0 +1,341 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#include "Actions/GameFeatureAction_AddEffects.h"
+#include "ModularFeatures_InternalFuncs.h"
+#include "MFEA_EventLog.h"
+#include "MFEA_Stats.h"
+#include <Engine/GameInstance.h>
+#include <Runtime/Launch/Resources/Version.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GameFeatureAction_AddEffects)
+#endif
+
+DECLARE_CYCLE_STAT(TEXT("Reset Effects"), STAT_MFEA_AddEffects_Reset, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Add Effects"), STAT_MFEA_AddEffects_Add, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Remove Effects"), STAT_MFEA_AddEffects_Remove, STATGROUP_MFEA);
+
+void UGameFeatureAction_AddEffects::OnGameFeatureActivating(FGameFeatureActivatingContext& Context)
+{
+	if (!ensureAlways(ActiveExtensions.IsEmpty()))
+	{
+		ResetExtension();
+	}
+
+	// Compile the tags before any actor is extended, the filter is checked for every addition event
+	RequireTagsFilter.Compile(RequireTags);
+
+	Super::OnGameFeatureActivating(Context);
+}
+
+void UGameFeatureAction_AddEffects::OnGameFeatureDeactivating(FGameFeatureDeactivatingContext& Context)
+{
+	Super::OnGameFeatureDeactivating(Context);
+	ResetExtension();
+}
+
+void UGameFeatureAction_AddEffects::ResetExtension()
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_AddEffects_Reset, this, nullptr);
+
+	// Tear down all records in a single pass instead of removing one actor at a time
+	ActiveExtensions.Reset([this](AActor* const Owner, const FEffectsExtension& Extension)
+	{
+		if (IsValid(Owner) && Owner->GetLocalRole() == ROLE_Authority)
+		{
+			RemoveAllEffects(Owner, Extension);
+		}
+	});
+
+	CompiledEffects.Empty();
+	SpecTemplates.Empty();
+
+	Super::ResetExtension();
+}
+
+int32 UGameFeatureAction_AddEffects::GetNumExtendedActors() const
+{
+	return ActiveExtensions.Num();
+}
+
+void UGameFeatureAction_AddEffects::AddToWorld(const FWorldContext& WorldContext)
+{
+	AddExtensionHandler(WorldContext, TargetPawnClass);
+}
+
+void UGameFeatureAction_AddEffects::GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const
+{
+	for (const FEffectStackedData& Entry : Effects)
+	{
+		ModularFeaturesHelper::AddSoftReferenceToPreload(OutAssets, Entry.EffectClass);
+	}
+}
+
+void UGameFeatureAction_AddEffects::OnAssetsPreloaded()
+{
+	Super::OnAssetsPreloaded();
+	CompileEffects();
+}
+
+#if WITH_EDITOR
+void UGameFeatureAction_AddEffects::ValidateActionData(TArray<FText>& OutErrors) const
+{
+	Super::ValidateActionData(OutErrors);
+	ValidateRequiredTags(RequireTags, OutErrors);
+
+	for (int32 Index = 0; Index < Effects.Num(); ++Index)
+	{
+		if (Effects[Index].EffectClass.IsNull())
+		{
+			OutErrors.Add(FText::FromString(FString::Printf(TEXT("Effects Mapping %d: Effect class is null."), Index)));
+		}
+
+		for (const TPair<FGameplayTag, float>& SetByCallerParam : Effects[Index].SetByCallerParams)
+		{
+			if (!SetByCallerParam.Key.IsValid())
+			{
+				OutErrors.Add(FText::FromString(FString::Printf(TEXT("Effects Mapping %d: Set By Caller parameter with an invalid tag."), Index)));
+			}
+		}
+	}
+}
+#endif
+
+void UGameFeatureAction_AddEffects::CompileEffects()
+{
+	CompiledEffects.Empty(Effects.Num());
+	SpecTemplates.Reset();
+
+	TMap<TPair<const UClass*, int32>, int32> TemplateIndices;
+
+	for (const FEffectStackedData& Entry : Effects)
+	{
+		FCompiledEffect& NewEffect = CompiledEffects.AddDefaulted_GetRef();
+
+		// Flatten the Set By Caller params, they'll be copied into each actor spec without walking the map
+		NewEffect.SetByCallerMagnitudes = Entry.SetByCallerParams.Array();
+
+		const UClass* const EffectClass = Entry.EffectClass.Get();
+		if (!IsValid(EffectClass))
+		{
+			continue;
+		}
+
+		const UGameplayEffect* const EffectCDO = GetDefault<UGameplayEffect>(EffectClass);
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION < 3
+		// Conditional effects are evaluated against the source tags when the spec is created, so we can't share a spec without context
+		if (!EffectCDO->ConditionalGameplayEffects.IsEmpty())
+		{
+			continue;
+		}
+#endif
+
+		if (const int32* const ExistingIndex = TemplateIndices.Find({EffectClass, Entry.EffectLevel}))
+		{
+			NewEffect.TemplateIndex = *ExistingIndex;
+			continue;
+		}
+
+		NewEffect.TemplateIndex = SpecTemplates.Emplace(EffectCDO, FGameplayEffectContextHandle(), Entry.EffectLevel);
+		TemplateIndices.Add({EffectClass, Entry.EffectLevel}, NewEffect.TemplateIndex);
+	}
+}
+
+void UGameFeatureAction_AddEffects::HandleActorExtension(const FMFEA_ExtensionContext& Context)
+{
+	if (Context.IsRemovalEvent())
+	{
+		QueueExtensionWork(Context, EExtensionWorkType::Remove);
+	}
+
+	else if (Context.IsAdditionEvent())
+	{
+		// We don't want to repeat the addition and cannot add if the user don't have the required tags
+		if (!IsValid(Context.GetActor()) || ActiveExtensions.Contains(Context.GetActor()) || !RequireTagsFilter.Matches(Context.ActorTags))
+		{
+			return;
+		}
+
+		QueueExtensionWork(Context, EExtensionWorkType::Add);
+	}
+}
+
+void UGameFeatureAction_AddEffects::ProcessExtensionWork(const FMFEA_ExtensionContext& Context, const EExtensionWorkType WorkType)
+{
+	if (WorkType == EExtensionWorkType::Remove)
+	{
+		RemoveEffects(Context.GetActor());
+		return;
+	}
+
+	// The actor may have been extended while this addition was waiting in the queue
+	if (ActiveExtensions.Contains(Context.GetActor()))
+	{
+		return;
+	}
+
+	// Applied after the attribute sets added to the actor by the other actions, so the effects will find the attributes they modify
+	Context.ExecuteInTransaction(FMFEA_AbilitySystemTransaction::EPhase::Effects, [WeakThis = TWeakObjectPtr<ThisClass>(this), Context]
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->AddActorEffects(Context);
+		}
+	});
+}
+
+void UGameFeatureAction_AddEffects::AddActorEffects(const FMFEA_ExtensionContext& Context)
+{
+	for (int32 Index = 0; Index < Effects.Num(); ++Index)
+	{
+		if (Effects[Index].EffectClass.IsNull())
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Effect class is null."), *FString(__FUNCTION__));
+		}
+		else if (CompiledEffects.IsValidIndex(Index))
+		{
+			AddEffects(Context, Effects[Index], CompiledEffects[Index]);
+		}
+	}
+}
+
+void UGameFeatureAction_AddEffects::AddEffects(const FMFEA_ExtensionContext& Context, const FEffectStackedData& Effect, const FCompiledEffect& CompiledEffect)
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_AddEffects_Add, this, Context.GetActor());
+
+	// Only proceed if the target actor is valid and has authority
+	AActor* const TargetActor = Context.GetActor();
+	if (!IsValid(TargetActor) || !Context.bHasAuthority)
+	{
+		return;
+	}
+
+	// Get the ability system component of the target actor, resolved once for all actions
+	if (UAbilitySystemComponent* const AbilitySystemComponent = Context.GetAbilitySystemComponent())
+	{
+		// Get the Effect class, already resident since the feature activation
+		const TSubclassOf<UGameplayEffect> EffectClass = Effect.EffectClass.Get();
+		if (!EffectClass)
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Effect class %s is not loaded."), *FString(__FUNCTION__),
+			       *Effect.EffectClass.ToString());
+			return;
+		}
+
+		// Register the target and its component, the handles are added once the effect is applied
+		FEffectsExtension& Extension = ActiveExtensions.FindOrAdd(TargetActor);
+		Extension.AbilitySystemComponent = AbilitySystemComponent;
+
+		FMFEA_EventLog::Record(EMFEA_EventAction::Effects, EMFEA_EventKind::Add, TargetActor, EffectClass);
+
+		const FGameplayEffectContextHandle EffectContext = AbilitySystemComponent->MakeEffectContext();
+
+		FGameplayEffectSpec NewSpec;
+		if (SpecTemplates.IsValidIndex(CompiledEffect.TemplateIndex))
+		{
+			// Clone the template created during the activation and bind it to the target context
+			NewSpec = SpecTemplates[CompiledEffect.TemplateIndex];
+			NewSpec.SetContext(EffectContext);
+			NewSpec.CaptureDataFromSource();
+		}
+		else
+		{
+			NewSpec.Initialize(GetDefault<UGameplayEffect>(EffectClass), EffectContext, Effect.EffectLevel);
+		}
+
+		// Add the flattened Set By Caller params to the Spec
+		for (const auto& [SetByCallerTag, SetByCallerMagnitude] : CompiledEffect.SetByCallerMagnitudes)
+		{
+			NewSpec.SetSetByCallerMagnitude(SetByCallerTag, SetByCallerMagnitude);
+		}
+
+		// Apply the effect data to the target Ability System Component - Instant effects have no active handle to be removed
+		if (const FActiveGameplayEffectHandle EffectHandle = AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(NewSpec); EffectHandle.IsValid())
+		{
+			Extension.EffectHandles.Add(EffectHandle);
+		}
+	}
+	else
+	{
+		FMFEA_EventLog::Record(EMFEA_EventAction::Effects, EMFEA_EventKind::Add, TargetActor, nullptr, EMFEA_EventResult::Failed);
+		UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Failed to find AbilitySystemComponent on Actor %s."), *FString(__FUNCTION__),
+		       *TargetActor->GetName());
+	}
+}
+
+void UGameFeatureAction_AddEffects::RemoveEffects(AActor* TargetActor)
+{
+	// Only proceed if the target actor is valid
+	if (!IsValid(TargetActor))
+	{
+		ActiveExtensions.Remove(TargetActor);
+		return;
+	}
+
+	// Only proceed if the target actor has authority
+	if (TargetActor->GetLocalRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_AddEffects_Remove, this, TargetActor);
+
+	// Only remove the effects applied to this actor: the component may also hold the effects of other actors extended by this action
+	if (const FEffectsExtension* const Extension = ActiveExtensions.Find(TargetActor))
+	{
+		if (UAbilitySystemComponent* const AbilitySystemComponent = Extension->AbilitySystemComponent.Get(); IsValid(AbilitySystemComponent))
+		{
+			for (const FActiveGameplayEffectHandle& EffectHandle : Extension->EffectHandles)
+			{
+				// Same asset as the addition events: the effect class
+				const UGameplayEffect* const EffectDefinition = AbilitySystemComponent->GetGameplayEffectDefForHandle(EffectHandle);
+				FMFEA_EventLog::Record(EMFEA_EventAction::Effects, EMFEA_EventKind::Remove, TargetActor,
+				                       EffectDefinition ? EffectDefinition->GetClass() : nullptr);
+
+				AbilitySystemComponent->RemoveActiveGameplayEffect(EffectHandle);
+			}
+		}
+		else if (IsValid(GetWorld()) && IsValid(GetWorld()->GetGameInstance()))
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Failed to find AbilitySystemComponent on Actor %s."),
+			       *FString(__FUNCTION__), *TargetActor->GetName());
+		}
+	}
+
+	ActiveExtensions.Remove(TargetActor);
+}
+
+void UGameFeatureAction_AddEffects::RemoveAllEffects(AActor* TargetActor, const FEffectsExtension& Extension)
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_AddEffects_Remove, this, TargetActor);
+
+	if (UAbilitySystemComponent* const AbilitySystemComponent = Extension.AbilitySystemComponent.Get(); IsValid(AbilitySystemComponent))
+	{
+		if (Extension.EffectHandles.IsEmpty())
+		{
+			return;
+		}
+
+		for (const FEffectStackedData& Effect : Effects)
+		{
+			FMFEA_EventLog::Record(EMFEA_EventAction::Effects, EMFEA_EventKind::Remove, TargetActor, Effect.EffectClass.Get());
+		}
+
+		// Remove the effects applied to this actor with a single query instead of one handle at a time
+		FGameplayEffectQuery Query;
+		Query.CustomMatchDelegate.BindLambda([&Extension](const FActiveGameplayEffect& ActiveEffect)
+		{
+			return Extension.EffectHandles.Contains(ActiveEffect.Handle);
+		});
+
+		AbilitySystemComponent->RemoveActiveEffects(Query);
+	}
+	else if (IsValid(GetWorld()) && IsValid(GetWorld()->GetGameInstance()))
+	{
+		UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Failed to find AbilitySystemComponent on Actor %s."),
+		       *FString(__FUNCTION__), *TargetActor->GetName());
+	}
+}
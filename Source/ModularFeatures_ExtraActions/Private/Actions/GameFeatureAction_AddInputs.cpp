@@ -0,0 +1,610 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#include "Actions/GameFeatureAction_AddInputs.h"
+#include "ModularFeatures_InternalFuncs.h"
+#include "MFEA_EventLog.h"
+#include "MFEA_Stats.h"
+#include <EnhancedInputSubsystems.h>
+#include <InputMappingContext.h>
+#include <InputActionValue.h>
+#include <GameFramework/PlayerController.h>
+#include <Engine/LocalPlayer.h>
+#include <UObject/ObjectSaveContext.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GameFeatureAction_AddInputs)
+#endif
+
+DECLARE_CYCLE_STAT(TEXT("Reset Inputs"), STAT_MFEA_AddInputs_Reset, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Add Inputs"), STAT_MFEA_AddInputs_Add, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Setup Action Bindings"), STAT_MFEA_AddInputs_SetupBindings, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Remove Inputs"), STAT_MFEA_AddInputs_Remove, STATGROUP_MFEA);
+
+namespace MFEA_AddInputs_Internal
+{
+	/* The bindings use the dynamic signature of the input component, which passes a single FInputActionValue. Functions without parameters ignore it */
+	static bool IsInputFunctionSignature(const UFunction* const Function)
+	{
+		// The parameters come first in the properties of the function, followed by the locals of script functions
+		const FProperty* Parameter = nullptr;
+		int32 NumParameters = 0;
+
+		for (TFieldIterator<FProperty> PropertyIt(Function); PropertyIt && PropertyIt->HasAnyPropertyFlags(CPF_Parm); ++PropertyIt)
+		{
+			// The delegate has no return value
+			if (PropertyIt->HasAnyPropertyFlags(CPF_ReturnParm))
+			{
+				return false;
+			}
+
+			Parameter = *PropertyIt;
+			++NumParameters;
+		}
+
+		if (NumParameters != Function->NumParms)
+		{
+			return false;
+		}
+
+		if (NumParameters == 0)
+		{
+			return Function->ParmsSize == 0;
+		}
+
+		const FStructProperty* const StructParameter = CastField<FStructProperty>(Parameter);
+		return NumParameters == 1 && StructParameter && StructParameter->Struct == FInputActionValue::StaticStruct()
+			&& Function->ParmsSize == StructParameter->GetSize();
+	}
+}
+
+void UGameFeatureAction_AddInputs::OnGameFeatureActivating(FGameFeatureActivatingContext& Context)
+{
+	if (!ensureAlways(ActiveExtensions.IsEmpty()))
+	{
+		ResetExtension();
+	}
+
+	// Compile the tags before any actor is extended, the filter is checked for every addition event
+	RequireTagsFilter.Compile(RequireTags);
+
+	Super::OnGameFeatureActivating(Context);
+}
+
+void UGameFeatureAction_AddInputs::OnGameFeatureDeactivating(FGameFeatureDeactivatingContext& Context)
+{
+	Super::OnGameFeatureDeactivating(Context);
+	ResetExtension();
+}
+
+void UGameFeatureAction_AddInputs::ResetExtension()
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_AddInputs_Reset, this, nullptr);
+
+	// Tear down all records in a single pass instead of removing one actor at a time
+	ActiveExtensions.Reset([this](AActor* const Owner, FInputBindingData& ActiveInputData)
+	{
+		if (APawn* const TargetPawn = Cast<APawn>(Owner); IsValid(TargetPawn))
+		{
+			RemoveActorInputs(TargetPawn, ActiveInputData);
+		}
+	});
+
+	CompiledBindings.Empty();
+	CompiledFunctionBindings.Empty();
+	ResolvedFunctionsByClass.Empty();
+
+	Super::ResetExtension();
+}
+
+int32 UGameFeatureAction_AddInputs::GetNumExtendedActors() const
+{
+	return ActiveExtensions.Num();
+}
+
+void UGameFeatureAction_AddInputs::AddToWorld(const FWorldContext& WorldContext)
+{
+	AddExtensionHandler(WorldContext, TargetPawnClass);
+}
+
+void UGameFeatureAction_AddInputs::GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const
+{
+	ModularFeaturesHelper::AddSoftReferenceToPreload(OutAssets, InputMappingContext);
+
+	for (const FInputMappingStack& Entry : ActionsBindings)
+	{
+		ModularFeaturesHelper::AddSoftReferenceToPreload(OutAssets, Entry.ActionInput);
+		ModularFeaturesHelper::AddSoftReferenceToPreload(OutAssets, Entry.AbilityBindingData.AbilityClass);
+	}
+
+	if (ModularFeaturesHelper::IsUsingInputIDEnumeration() && !HasBakedInputIDs())
+	{
+		ModularFeaturesHelper::AddSoftReferenceToPreload(OutAssets, ModularFeaturesHelper::GetPluginSettings()->InputIDEnumeration);
+	}
+}
+
+void UGameFeatureAction_AddInputs::OnAssetsPreloaded()
+{
+	Super::OnAssetsPreloaded();
+	CompileActionsBindings();
+}
+
+void UGameFeatureAction_AddInputs::PreSave(const FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	// The editor data always resolves the InputIDs on activation
+	BakedInputIDs.Reset();
+
+	if (SaveContext.IsCooking())
+	{
+		for (const FInputMappingStack& Entry : ActionsBindings)
+		{
+			BakedInputIDs.Add(Entry.AbilityBindingData.bSetupAbilityInput
+				                  ? ModularFeaturesHelper::GetInputIDByName(Entry.AbilityBindingData.InputIDValueName)
+				                  : INDEX_NONE);
+		}
+	}
+}
+
+#if WITH_EDITOR
+void UGameFeatureAction_AddInputs::ValidateActionData(TArray<FText>& OutErrors) const
+{
+	Super::ValidateActionData(OutErrors);
+	ValidateRequiredTags(RequireTags, OutErrors);
+
+	if (InputMappingContext.IsNull())
+	{
+		OutErrors.Add(FText::FromString(TEXT("Input Mapping Context is null.")));
+	}
+
+	for (int32 Index = 0; Index < ActionsBindings.Num(); ++Index)
+	{
+		const auto& [ActionInput, AbilityBindingData, FunctionBindingData] = ActionsBindings[Index];
+
+		if (ActionInput.IsNull())
+		{
+			OutErrors.Add(FText::FromString(FString::Printf(TEXT("Actions Bindings %d: Action Input is null."), Index)));
+		}
+
+		for (const FFunctionStackedData& FunctionBinding : FunctionBindingData)
+		{
+			if (FunctionBinding.FunctionName.IsNone())
+			{
+				OutErrors.Add(FText::FromString(FString::Printf(TEXT("Actions Bindings %d: UFunction binding without function name."), Index)));
+			}
+		}
+
+		if (!AbilityBindingData.bSetupAbilityInput)
+		{
+			continue;
+		}
+
+		if (AbilityBindingData.bFindAbilitySpec && AbilityBindingData.AbilityClass.IsNull())
+		{
+			OutErrors.Add(FText::FromString(FString::Printf(TEXT("Actions Bindings %d: Find Ability Spec requires the Ability Class."), Index)));
+		}
+
+		if (ModularFeaturesHelper::IsUsingInputIDEnumeration() && ModularFeaturesHelper::GetInputIDByName(AbilityBindingData.InputIDValueName) == INDEX_NONE)
+		{
+			OutErrors.Add(FText::FromString(FString::Printf(TEXT("Actions Bindings %d: InputID Value Name %s not found in the InputID Enumeration."),
+			                                                Index, *AbilityBindingData.InputIDValueName.ToString())));
+		}
+	}
+}
+#endif
+
+bool UGameFeatureAction_AddInputs::HasBakedInputIDs() const
+{
+#if WITH_EDITOR
+	return false;
+#else
+	return BakedInputIDs.Num() == ActionsBindings.Num();
+#endif
+}
+
+void UGameFeatureAction_AddInputs::CompileActionsBindings()
+{
+	CompiledBindings.Empty(ActionsBindings.Num());
+	CompiledFunctionBindings.Reset();
+	ResolvedFunctionsByClass.Reset();
+
+	const bool bUseBakedInputIDs = HasBakedInputIDs();
+
+	for (int32 Index = 0; Index < ActionsBindings.Num(); ++Index)
+	{
+		const auto& [ActionInput, AbilityBindingData, FunctionBindingData] = ActionsBindings[Index];
+
+		// Check if the action input is valid
+		if (ActionInput.IsNull())
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Action Input is null."), *FString(__FUNCTION__));
+			continue;
+		}
+
+		// Get the Action Input, already resident since the feature activation
+		UInputAction* const InputAction = ActionInput.Get();
+		if (!IsValid(InputAction))
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Action Input %s is not loaded."), *FString(__FUNCTION__),
+			       *ActionInput.ToString());
+			continue;
+		}
+
+		FCompiledActionBinding& NewBinding = CompiledBindings.AddDefaulted_GetRef();
+		NewBinding.InputAction = InputAction;
+		NewBinding.FirstFunctionBinding = CompiledFunctionBindings.Num();
+
+		// Flatten all UFunctions and their triggers into a single contiguous range
+		for (const auto& [FunctionName, Triggers] : FunctionBindingData)
+		{
+			for (const ETriggerEvent& Trigger : Triggers)
+			{
+				CompiledFunctionBindings.Add({FunctionName, Trigger});
+			}
+		}
+
+		NewBinding.NumFunctionBindings = CompiledFunctionBindings.Num() - NewBinding.FirstFunctionBinding;
+
+		// Check if this input will be used to setup existing abilities
+		NewBinding.bSetupAbilityInput = AbilityBindingData.bSetupAbilityInput;
+		if (!NewBinding.bSetupAbilityInput)
+		{
+			continue;
+		}
+
+		NewBinding.bFindAbilitySpec = AbilityBindingData.bFindAbilitySpec;
+
+		// Create a basic spec just to pass some parameters to the ability binding
+		NewBinding.AbilitySpec.InputID = bUseBakedInputIDs
+			                                 ? BakedInputIDs[Index]
+			                                 : ModularFeaturesHelper::GetInputIDByName(AbilityBindingData.InputIDValueName);
+
+		// Only add the class if it's valid
+		if (const UClass* const AbilityClass = AbilityBindingData.AbilityClass.Get())
+		{
+			NewBinding.AbilitySpec.Ability = Cast<UGameplayAbility>(AbilityClass->GetDefaultObject());
+		}
+
+		// Kept with the binding instead of being appended to the ability default object, which is shared by every user of the class
+		NewBinding.AbilityTags = AbilityBindingData.AbilityTags;
+	}
+}
+
+const TArray<UFunction*>& UGameFeatureAction_AddInputs::ResolveFunctionBindings(const UClass* FunctionOwnerClass)
+{
+	if (const TArray<UFunction*>* const ExistingFunctions = ResolvedFunctionsByClass.Find(FunctionOwnerClass))
+	{
+		return *ExistingFunctions;
+	}
+
+	TArray<UFunction*> Functions;
+	Functions.Reserve(CompiledFunctionBindings.Num());
+
+	// The same function is usually bound to several triggers, so each name is only resolved and reported once
+	TMap<FName, UFunction*> FunctionsByName;
+
+	for (const FCompiledFunctionBinding& FunctionBinding : CompiledFunctionBindings)
+	{
+		if (UFunction* const* const ExistingFunction = FunctionsByName.Find(FunctionBinding.FunctionName))
+		{
+			Functions.Add(*ExistingFunction);
+			continue;
+		}
+
+		UFunction* Function = FunctionOwnerClass->FindFunctionByName(FunctionBinding.FunctionName);
+		if (!Function)
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Function %s not found in class %s. Its bindings will be ignored."),
+			       *FString(__FUNCTION__), *FunctionBinding.FunctionName.ToString(), *FunctionOwnerClass->GetName());
+		}
+		else if (!MFEA_AddInputs_Internal::IsInputFunctionSignature(Function))
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error,
+			       TEXT("%s: Function %s of class %s must have no parameters or a single Input Action Value parameter. Its bindings will be ignored."),
+			       *FString(__FUNCTION__), *FunctionBinding.FunctionName.ToString(), *FunctionOwnerClass->GetName());
+
+			Function = nullptr;
+		}
+
+		FunctionsByName.Add(FunctionBinding.FunctionName, Function);
+		Functions.Add(Function);
+	}
+
+	return ResolvedFunctionsByClass.Add(FunctionOwnerClass, MoveTemp(Functions));
+}
+
+void UGameFeatureAction_AddInputs::HandleActorExtension(const FMFEA_ExtensionContext& Context)
+{
+	if (Context.IsRemovalEvent())
+	{
+		QueueExtensionWork(Context, EExtensionWorkType::Remove);
+	}
+
+	else if (Context.IsAdditionEvent())
+	{
+		// We don't want to repeat the addition and cannot add if the user don't have the required tags
+		if (!IsValid(Context.GetActor()) || ActiveExtensions.Contains(Context.GetActor()) || !RequireTagsFilter.Matches(Context.ActorTags))
+		{
+			return;
+		}
+
+		QueueExtensionWork(Context, EExtensionWorkType::Add);
+	}
+}
+
+void UGameFeatureAction_AddInputs::ProcessExtensionWork(const FMFEA_ExtensionContext& Context, const EExtensionWorkType WorkType)
+{
+	if (WorkType == EExtensionWorkType::Remove)
+	{
+		RemoveActorInputs(Context.GetActor());
+		return;
+	}
+
+	// The actor may have been extended while this addition was waiting in the queue
+	if (ActiveExtensions.Contains(Context.GetActor()))
+	{
+		return;
+	}
+
+	if (InputMappingContext.IsNull())
+	{
+		UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Input Mapping Context is null."), *FString(__FUNCTION__));
+		return;
+	}
+
+	// Bound after the abilities given to the actor by the other actions, so the ability bindings will find their specs
+	Context.ExecuteInTransaction(FMFEA_AbilitySystemTransaction::EPhase::Inputs, [WeakThis = TWeakObjectPtr<ThisClass>(this), Context]
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->AddActorInputs(Context);
+		}
+	});
+}
+
+void UGameFeatureAction_AddInputs::AddActorInputs(const FMFEA_ExtensionContext& Context)
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_AddInputs_Add, this, Context.GetActor());
+
+	// Only proceed if the target actor is valid
+	AActor* const TargetActor = Context.GetActor();
+	if (!IsValid(TargetActor))
+	{
+		return;
+	}
+
+	// Get the target pawn and check if it is valid. We don't want to add inputs to a non-pawn actor
+	APawn* const TargetPawn = Cast<APawn>(TargetActor);
+	if (!IsValid(TargetPawn))
+	{
+		return;
+	}
+
+	// Try to get the enhanced input subsystem from the pawn
+	if (UEnhancedInputLocalPlayerSubsystem* const Subsystem = GetEnhancedInputComponentFromPawn(TargetPawn))
+	{
+		// Get the Input Mapping context, already resident since the feature activation
+		UInputMappingContext* const InputMapping = InputMappingContext.Get();
+		if (!IsValid(InputMapping))
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Input Mapping Context %s is not loaded."), *FString(__FUNCTION__),
+			       *InputMappingContext.ToString());
+			return;
+		}
+
+		// Cehck if there's already an existing input data associated to the target actor and get it or create a new one
+		FInputBindingData& NewInputData = ActiveExtensions.FindOrAdd(TargetActor);
+
+		FMFEA_EventLog::Record(EMFEA_EventAction::Inputs, EMFEA_EventKind::Add, TargetActor, InputMapping);
+
+		// Add the loaded mapping context into the enhanced input subsystem at the end of the frame, together with the changes of the other actions
+		UMFEA_ExtensionSubsystem::QueueMappingContextChange(Subsystem, InputMapping, MappingPriority, true);
+
+		// Add the mapping context to the input data
+		NewInputData.Mapping = InputMapping;
+
+		// Get the Function Owner, the UObject which owns the specified UFunction that will be used to bind the input activation and check if it's valid
+		const TWeakObjectPtr<UObject> FunctionOwner = ModularFeaturesHelper::GetPawnInputOwner(TargetPawn, InputBindingOwnerOverride);
+		if (!FunctionOwner.IsValid())
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Failed to get the function owner using the Actor %s."),
+			       *FString(__FUNCTION__), *TargetActor->GetName());
+			return;
+		}
+
+		// Get the Enhanced Input component of the target Pawn and check if it's valid
+		const TWeakObjectPtr<UEnhancedInputComponent> InputComponent = ModularFeaturesHelper::GetEnhancedInputComponentInPawn(TargetPawn);
+		if (!InputComponent.IsValid())
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Failed to find InputComponent on Actor %s."), *FString(__FUNCTION__),
+			       *TargetActor->GetName());
+			return;
+		}
+
+		// If everything is okay, setup the action bindings and add the extension to the active map
+		SetupActionBindings(Context, FunctionOwner.Get(), InputComponent.Get());
+	}
+	else if (TargetPawn->IsPawnControlled())
+	{
+		UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Failed to find PlayerController on Actor %s."), *FString(__FUNCTION__),
+		       *TargetActor->GetName());
+	}
+}
+
+void UGameFeatureAction_AddInputs::RemoveActorInputs(AActor* TargetActor)
+{
+	// Only proceed if the target actor is valid
+	if (!IsValid(TargetActor))
+	{
+		ActiveExtensions.Remove(TargetActor);
+		return;
+	}
+
+	// Get the target pawn and check if it is valid. We don't want to check inputs from a non-pawn actor
+	APawn* const TargetPawn = Cast<APawn>(TargetActor);
+	if (!IsValid(TargetPawn))
+	{
+		ActiveExtensions.Remove(TargetActor);
+		return;
+	}
+
+	// Check if there's existing active input data
+	if (FInputBindingData* const ActiveInputData = ActiveExtensions.Find(TargetActor))
+	{
+		RemoveActorInputs(TargetPawn, *ActiveInputData);
+	}
+
+	ActiveExtensions.Remove(TargetActor);
+}
+
+void UGameFeatureAction_AddInputs::RemoveActorInputs(APawn* TargetPawn, FInputBindingData& ActiveInputData)
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_AddInputs_Remove, this, TargetPawn);
+
+	// Try to get the enhanced input subsystem from the pawn
+	if (UEnhancedInputLocalPlayerSubsystem* const Subsystem = GetEnhancedInputComponentFromPawn(TargetPawn))
+	{
+		FMFEA_EventLog::Record(EMFEA_EventAction::Inputs, EMFEA_EventKind::Remove, TargetPawn, ActiveInputData.Mapping.Get());
+
+		// Try to get the enhanced input component of the target pawn
+		if (const TWeakObjectPtr<UEnhancedInputComponent> InputComponent = ModularFeaturesHelper::GetEnhancedInputComponentInPawn(TargetPawn); !
+			InputComponent.IsValid())
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Failed to find InputComponent on Actor %s."), *FString(__FUNCTION__),
+			       *TargetPawn->GetName());
+		}
+		else
+		{
+			// Iterate through the active bindings and remove all
+			for (const FInputBindingHandle& InputActionBinding : ActiveInputData.ActionBinding)
+			{
+				InputComponent->RemoveBinding(InputActionBinding);
+			}
+
+			// Verify and try to remove the ability bindings by calling the RemoveAbilityInputBinding from IMFEA_AbilityInputBinding interface
+			if (UObject* const SetupInputInterface = ModularFeaturesHelper::GetAbilityInputBindingOwner(TargetPawn, InputBindingOwnerOverride))
+			{
+				ModularFeaturesHelper::RemoveAbilityInputInInterfaceOwner(SetupInputInterface, ActiveInputData.AbilityActions);
+			}
+		}
+
+		// Remove the mapping context from the subsystem at the end of the frame, together with the changes of the other actions
+		UMFEA_ExtensionSubsystem::QueueMappingContextChange(Subsystem, ActiveInputData.Mapping.Get(), MappingPriority, false);
+	}
+}
+
+void UGameFeatureAction_AddInputs::SetupActionBindings(const FMFEA_ExtensionContext& Context, UObject* FunctionOwner,
+                                                      UEnhancedInputComponent* InputComponent)
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_AddInputs_SetupBindings, this, Context.GetActor());
+
+	AActor* const TargetActor = Context.GetActor();
+
+	// Get the existing input data
+	FInputBindingData& NewInputData = ActiveExtensions.FindOrAdd(TargetActor);
+	NewInputData.ActionBinding.Reserve(NewInputData.ActionBinding.Num() + CompiledFunctionBindings.Num());
+
+	// Functions resolved once per function owner class, the bindings without a valid function are skipped
+	const TArray<UFunction*>& Functions = ResolveFunctionBindings(FunctionOwner->GetClass());
+
+	// Ability bindings are collected and sent to the interface owner with a single call after the loop
+	TArray<FMFEA_AbilityBindingEntry> AbilityBindings;
+
+	// Iterate through the bindings compiled during the activation to add all of them
+	for (const FCompiledActionBinding& Binding : CompiledBindings)
+	{
+		FMFEA_EventLog::Record(EMFEA_EventAction::Inputs, EMFEA_EventKind::Bind, TargetActor, Binding.InputAction);
+
+		// Bind the UFunctions to its corresponding input and trigger type
+		for (int32 Index = Binding.FirstFunctionBinding; Index < Binding.FirstFunctionBinding + Binding.NumFunctionBindings; ++Index)
+		{
+			if (const UFunction* const Function = Functions[Index])
+			{
+				NewInputData.ActionBinding.Add(
+					InputComponent->BindAction(Binding.InputAction, CompiledFunctionBindings[Index].Trigger, FunctionOwner, Function->GetFName()));
+			}
+		}
+
+		// Check if this input will be used to setup existing abilities
+		if (!Binding.bSetupAbilityInput)
+		{
+			continue;
+		}
+
+		AbilityBindings.Add(ModularFeaturesHelper::MakeAbilityBindingEntry(Binding.InputAction, GetAbilitySpecFromCompiledBinding(Context, Binding),
+		                                                                   Binding.AbilityTags));
+	}
+
+	if (AbilityBindings.IsEmpty())
+	{
+		return;
+	}
+
+	// Try to bind the inputs using the ability input binding interfaces implemented by the owner
+	if (UObject* const SetupInputInterface = ModularFeaturesHelper::GetAbilityInputBindingOwner(TargetActor, InputBindingOwnerOverride);
+		ModularFeaturesHelper::BindAbilityInputsToInterfaceOwner(SetupInputInterface, AbilityBindings))
+	{
+		NewInputData.AbilityActions.Reserve(NewInputData.AbilityActions.Num() + AbilityBindings.Num());
+		for (const FMFEA_AbilityBindingEntry& AbilityBinding : AbilityBindings)
+		{
+			NewInputData.AbilityActions.Add(AbilityBinding.Action);
+		}
+	}
+}
+
+UEnhancedInputLocalPlayerSubsystem* UGameFeatureAction_AddInputs::GetEnhancedInputComponentFromPawn(APawn* TargetPawn)
+{
+	// Get the Player Controller associated to this pawn
+	if (const APlayerController* const PlayerController = TargetPawn->GetController<APlayerController>())
+	{
+		// Check if the controller is local. We don't want to add inputs to a non-local player
+		if (!PlayerController->IsLocalController())
+		{
+			return nullptr;
+		}
+
+		// Get the local player associated to the controller
+		if (const ULocalPlayer* const LocalPlayer = PlayerController->GetLocalPlayer())
+		{
+			// Get the enhanced input subsystem of the local player and check if its valid
+			UEnhancedInputLocalPlayerSubsystem* const Subsystem = LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>();
+			if (!IsValid(Subsystem))
+			{
+				UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: LocalPlayer %s has no EnhancedInputLocalPlayerSubsystem."),
+				       *FString(__FUNCTION__), *LocalPlayer->GetName());
+				return nullptr;
+			}
+
+			return Subsystem;
+		}
+	}
+
+	return nullptr;
+}
+
+const FGameplayAbilitySpec& UGameFeatureAction_AddInputs::GetAbilitySpecFromCompiledBinding(const FMFEA_ExtensionContext& Context,
+                                                                                             const FCompiledActionBinding& Binding) const
+{
+	// If the user wants to find a active ability spec, we'll try to get the ability system component of the target actor and get the spec using the specified ability class
+	if (Binding.bFindAbilitySpec && IsValid(Binding.AbilitySpec.Ability))
+	{
+		if (const UAbilitySystemComponent* const AbilitySystemComponent = Context.GetAbilitySystemComponent())
+		{
+			// We're not using the InputID to search for existing spec because more than 1 abilities can have the same Input Id
+			if (const FGameplayAbilitySpec* const ActiveSpec = AbilitySystemComponent->FindAbilitySpecFromClass(Binding.AbilitySpec.Ability->GetClass()))
+			{
+				return *ActiveSpec;
+			}
+		}
+		else
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Failed to find AbilitySystemComponent on Actor %s."),
+			       *FString(__FUNCTION__), *GetNameSafe(Context.GetActor()));
+		}
+	}
+
+	// If we are not using an existing spec, we'll use the basic spec created during the compilation
+	return Binding.AbilitySpec;
+}
@@ -0,0 +1,548 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#include "Actions/GameFeatureAction_SpawnActors.h"
+#include "LogModularFeatures_ExtraActions.h"
+#include "MFEA_EventLog.h"
+#include "MFEA_Stats.h"
+#include "MFEA_Containers.h"
+#include <Components/GameFrameworkComponentManager.h>
+#include <Engine/AssetManager.h>
+#include <Engine/StreamableManager.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GameFeatureAction_SpawnActors)
+#endif
+
+DECLARE_CYCLE_STAT(TEXT("Reset Spawned Actors"), STAT_MFEA_SpawnActors_Reset, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Spawn Actors"), STAT_MFEA_SpawnActors_Spawn, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Destroy Actors"), STAT_MFEA_SpawnActors_Destroy, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Process Pending Spawns"), STAT_MFEA_SpawnActors_ProcessSpawns, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Process Pending Destroys"), STAT_MFEA_SpawnActors_ProcessDestroys, STATGROUP_MFEA);
+
+void UGameFeatureAction_SpawnActors::PostLoad()
+{
+	Super::PostLoad();
+
+	// Move the deprecated single target level into the target levels array
+	if (!TargetLevel_DEPRECATED.IsNull())
+	{
+		TargetLevels.AddUnique(TargetLevel_DEPRECATED);
+		TargetLevel_DEPRECATED.Reset();
+	}
+}
+
+void UGameFeatureAction_SpawnActors::OnGameFeatureActivating(FGameFeatureActivatingContext& Context)
+{
+	if (!ensureAlways(SpawnedActors.IsEmpty()))
+	{
+		ResetExtension();
+	}
+
+	// Store the package names of the target levels to compare with the initialized worlds without loading the level assets
+	TargetLevelNames.Empty(TargetLevels.Num());
+	for (const TSoftObjectPtr<UWorld>& Level : TargetLevels)
+	{
+		if (!Level.IsNull())
+		{
+			TargetLevelNames.Add(FName(*Level.ToSoftObjectPath().GetLongPackageName()));
+		}
+	}
+
+	ActivationContext = Context;
+
+	TArray<FSoftObjectPath> ClassesToLoad;
+	for (const FActorSpawnSettings& Settings : SpawnSettings)
+	{
+		if (!Settings.ActorClass.IsNull())
+		{
+			ClassesToLoad.AddUnique(Settings.ActorClass.ToSoftObjectPath());
+		}
+	}
+
+	// Nothing to stream: we can spawn the actors right away
+	if (ClassesToLoad.IsEmpty())
+	{
+		HandleClassesLoaded();
+		return;
+	}
+
+	// Stream all classes with a single request and only start spawning once they are resident, so the spawns inside the frame budget will not load from disk
+	ClassesHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(ClassesToLoad),
+	                                                                       FStreamableDelegate::CreateUObject(
+		                                                                       this, &UGameFeatureAction_SpawnActors::HandleClassesLoaded),
+	                                                                       FStreamableManager::AsyncLoadHighPriority);
+
+	if (!ClassesHandle.IsValid())
+	{
+		UE_LOG(LogGameplayFeaturesExtraActions, Warning, TEXT("%s: Failed to request the actor classes of action %s."), *FString(__FUNCTION__),
+		       *GetName());
+
+		HandleClassesLoaded();
+	}
+}
+
+void UGameFeatureAction_SpawnActors::OnGameFeatureDeactivating(FGameFeatureDeactivatingContext& Context)
+{
+	FWorldDelegates::OnPostWorldInitialization.Remove(WorldInitializedHandle);
+	ResetExtension();
+	ReleaseClassesHandle();
+}
+
+void UGameFeatureAction_SpawnActors::HandleClassesLoaded()
+{
+	for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+	{
+		if (ActivationContext.ShouldApplyToWorldContext(WorldContext))
+		{
+			AddToWorld(WorldContext.World());
+		}
+	}
+
+	WorldInitializedHandle = FWorldDelegates::OnPostWorldInitialization.AddUObject(this, &UGameFeatureAction_SpawnActors::OnWorldInitialized);
+}
+
+void UGameFeatureAction_SpawnActors::ReleaseClassesHandle()
+{
+	if (!ClassesHandle.IsValid())
+	{
+		return;
+	}
+
+	// Cancel the request if the feature was deactivated before the load completes, otherwise just release the loaded classes
+	if (ClassesHandle->IsLoadingInProgress())
+	{
+		ClassesHandle->CancelHandle();
+	}
+	else
+	{
+		ClassesHandle->ReleaseHandle();
+	}
+
+	ClassesHandle.Reset();
+}
+
+void UGameFeatureAction_SpawnActors::OnGameFeatureUnregistering()
+{
+	Super::OnGameFeatureUnregistering();
+	EmptyActorPool();
+}
+
+void UGameFeatureAction_SpawnActors::ResetExtension()
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_SpawnActors_Reset, this, nullptr);
+
+	DestroyActors();
+	TargetLevelNames.Empty();
+}
+
+void UGameFeatureAction_SpawnActors::OnWorldInitialized(UWorld* World, [[maybe_unused]] const UWorld::InitializationValues)
+{
+	AddToWorld(World);
+}
+
+void UGameFeatureAction_SpawnActors::AddToWorld(UWorld* World)
+{
+	if (TargetLevelNames.IsEmpty() || !IsValid(World) || !World->IsGameWorld() || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	// PIE worlds are duplicated into prefixed packages, so we need to remove the prefix before comparing with the target levels
+	const FName WorldPackageName = World->IsPlayInEditor()
+		                               ? FName(*UWorld::RemovePIEPrefix(World->GetOutermost()->GetName()))
+		                               : World->GetOutermost()->GetFName();
+
+	if (TargetLevelNames.Contains(WorldPackageName))
+	{
+		SpawnActors(World);
+	}
+}
+
+void UGameFeatureAction_SpawnActors::SpawnActors(UWorld* WorldReference)
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_SpawnActors_Spawn, this, WorldReference);
+
+	// Only proceed if the world is valid
+	if (!IsValid(WorldReference))
+	{
+		return;
+	}
+
+	const bool bTimeSliced = IsSpawnTimeSliced();
+
+	// Iterate through all spawn settings and spawn the actors with the given data
+	for (int32 Index = 0; Index < SpawnSettings.Num(); ++Index)
+	{
+		const auto& [ActorClass, SpawnTransform] = SpawnSettings[Index];
+
+		// Check if the soft reference is null
+		if (ActorClass.IsNull())
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Actor class is null."), *FString(__FUNCTION__));
+			continue;
+		}
+
+		// Get the actor class, already resident since the feature activation
+		const TSubclassOf<AActor> ClassToSpawn = ActorClass.Get();
+		if (!ClassToSpawn)
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Actor class %s is not loaded."), *FString(__FUNCTION__),
+			       *ActorClass.ToString());
+			continue;
+		}
+
+		// Reuse a parked actor if there's one available for this class
+		if (bPoolActors)
+		{
+			if (AActor* const PooledActor = ReusePooledActor(WorldReference, ClassToSpawn, SpawnTransform))
+			{
+				SpawnedActors.Add(PooledActor);
+				continue;
+			}
+		}
+
+		// Spread the spawns across the next frames if the user specified a budget
+		if (bTimeSliced)
+		{
+			PendingSpawns.Add({WorldReference, Index});
+			++SpawnTotal;
+			continue;
+		}
+
+		// Spawn the actor and add it to the spawned array
+		AActor* const NewActor = WorldReference->SpawnActor<AActor>(ClassToSpawn, SpawnTransform);
+		SpawnedActors.Add(NewActor);
+
+		FMFEA_EventLog::Record(EMFEA_EventAction::SpawnActors, EMFEA_EventKind::Spawn, NewActor, ClassToSpawn,
+		                       IsValid(NewActor) ? EMFEA_EventResult::Success : EMFEA_EventResult::Failed);
+	}
+
+	if (!PendingSpawns.IsEmpty())
+	{
+		StartPendingActorsTicker();
+	}
+}
+
+void UGameFeatureAction_SpawnActors::DestroyActors()
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_SpawnActors_Destroy, this, nullptr);
+
+	// Cancel the spawns that didn't start yet and destroy the actors waiting for the construction
+	PendingSpawns.Empty();
+	for (const FDeferredSpawn& DeferredSpawn : DeferredSpawns)
+	{
+		if (DeferredSpawn.Actor.IsValid())
+		{
+			DeferredSpawn.Actor->Destroy();
+		}
+	}
+
+	DeferredSpawns.Empty();
+	SpawnTotal = 0;
+
+	// Park the actors in the pool instead of destroying them if the user enabled the pooling
+	if (bPoolActors)
+	{
+		SpawnedActors.RemoveAllSwap([this](const TWeakObjectPtr<AActor>& ActorPtr)
+		{
+			return !ActorPtr.IsValid() || ParkActor(ActorPtr.Get());
+		});
+	}
+
+	// Move the spawned actors to the destroy queue if the user specified a budget
+	if (IsDestroyTimeSliced())
+	{
+		DestroyTotal += SpawnedActors.Num();
+		PendingDestroys.Append(MoveTemp(SpawnedActors));
+		SpawnedActors.Empty();
+
+		if (!PendingDestroys.IsEmpty())
+		{
+			StartPendingActorsTicker();
+		}
+
+		return;
+	}
+
+	// Iterate through all spawned actors and destroy all valid actors
+	for (const TWeakObjectPtr<AActor>& ActorPtr : SpawnedActors)
+	{
+		if (!ActorPtr.IsValid())
+		{
+			continue;
+		}
+
+		FMFEA_EventLog::Record(EMFEA_EventAction::SpawnActors, EMFEA_EventKind::Destroy, ActorPtr.Get(), ActorPtr->GetClass());
+		ActorPtr->Destroy();
+	}
+
+	SpawnedActors.Empty();
+}
+
+bool UGameFeatureAction_SpawnActors::IsSpawnTimeSliced() const
+{
+	return MaxSpawnsPerFrame > 0 || FrameBudget > 0.f;
+}
+
+bool UGameFeatureAction_SpawnActors::IsDestroyTimeSliced() const
+{
+	return MaxDestroysPerFrame > 0 || FrameBudget > 0.f;
+}
+
+bool UGameFeatureAction_SpawnActors::HasFrameBudget(const double StartTime) const
+{
+	return FrameBudget <= 0.f || (FPlatformTime::Seconds() - StartTime) * 1000.0 < FrameBudget;
+}
+
+void UGameFeatureAction_SpawnActors::StartPendingActorsTicker()
+{
+	if (!PendingActorsTickerHandle.IsValid())
+	{
+		PendingActorsTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UGameFeatureAction_SpawnActors::ProcessPendingActors));
+	}
+}
+
+bool UGameFeatureAction_SpawnActors::ProcessPendingActors([[maybe_unused]] float DeltaTime)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	const bool bHasPendingDestroys = ProcessPendingDestroys(StartTime);
+	const bool bHasPendingSpawns = ProcessPendingSpawns(StartTime);
+
+	if (bHasPendingDestroys || bHasPendingSpawns)
+	{
+		return true;
+	}
+
+	PendingActorsTickerHandle.Reset();
+	return false;
+}
+
+bool UGameFeatureAction_SpawnActors::ProcessPendingSpawns(const double StartTime)
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_SpawnActors_ProcessSpawns, this, nullptr);
+
+	if (PendingSpawns.IsEmpty() && DeferredSpawns.IsEmpty())
+	{
+		return false;
+	}
+
+	// Finish the construction of the actors spawned in the last frame
+	for (const auto& [Actor, SettingsIndex] : DeferredSpawns)
+	{
+		if (Actor.IsValid() && SpawnSettings.IsValidIndex(SettingsIndex))
+		{
+			Actor->FinishSpawning(SpawnSettings[SettingsIndex].SpawnTransform);
+			SpawnedActors.Add(Actor);
+		}
+	}
+
+	DeferredSpawns.Reset();
+
+	// Always start at least one spawn to guarantee the progress
+	int32 StartedNum = 0;
+	while (StartedNum < PendingSpawns.Num() && (StartedNum == 0 || (HasFrameBudget(StartTime) && (MaxSpawnsPerFrame <= 0 || StartedNum <
+		MaxSpawnsPerFrame))))
+	{
+		const auto& [World, SettingsIndex] = PendingSpawns[StartedNum++];
+		if (!World.IsValid() || !SpawnSettings.IsValidIndex(SettingsIndex))
+		{
+			continue;
+		}
+
+		const TSubclassOf<AActor> ClassToSpawn = SpawnSettings[SettingsIndex].ActorClass.Get();
+		if (!ClassToSpawn)
+		{
+			continue;
+		}
+
+		// Spawn deferred to split the construction with the next frame
+		AActor* const NewActor = World->SpawnActorDeferred<AActor>(ClassToSpawn, SpawnSettings[SettingsIndex].SpawnTransform);
+		if (IsValid(NewActor))
+		{
+			DeferredSpawns.Add({NewActor, SettingsIndex});
+		}
+
+		FMFEA_EventLog::Record(EMFEA_EventAction::SpawnActors, EMFEA_EventKind::Spawn, NewActor, ClassToSpawn,
+		                       IsValid(NewActor) ? EMFEA_EventResult::Success : EMFEA_EventResult::Failed);
+	}
+
+	PendingSpawns.RemoveAt(0, StartedNum, MFEA_Containers::NoShrinking);
+
+	const int32 SpawnedNum = SpawnTotal - PendingSpawns.Num() - DeferredSpawns.Num();
+	OnSpawnProgress.Broadcast(this, SpawnedNum, SpawnTotal);
+
+	if (PendingSpawns.IsEmpty() && DeferredSpawns.IsEmpty())
+	{
+		SpawnTotal = 0;
+		return false;
+	}
+
+	return true;
+}
+
+bool UGameFeatureAction_SpawnActors::ProcessPendingDestroys(const double StartTime)
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_SpawnActors_ProcessDestroys, this, nullptr);
+
+	if (PendingDestroys.IsEmpty())
+	{
+		return false;
+	}
+
+	// Always destroy at least one actor to guarantee the progress
+	int32 ProcessedNum = 0;
+	while (ProcessedNum < PendingDestroys.Num() && (ProcessedNum == 0 || (HasFrameBudget(StartTime) && (MaxDestroysPerFrame <= 0 || ProcessedNum <
+		MaxDestroysPerFrame))))
+	{
+		if (const TWeakObjectPtr<AActor>& ActorPtr = PendingDestroys[ProcessedNum++]; ActorPtr.IsValid())
+		{
+			FMFEA_EventLog::Record(EMFEA_EventAction::SpawnActors, EMFEA_EventKind::Destroy, ActorPtr.Get(), ActorPtr->GetClass());
+			ActorPtr->Destroy();
+		}
+	}
+
+	PendingDestroys.RemoveAt(0, ProcessedNum, MFEA_Containers::NoShrinking);
+	DestroyedNum += ProcessedNum;
+
+	OnDestroyProgress.Broadcast(this, DestroyedNum, DestroyTotal);
+
+	if (PendingDestroys.IsEmpty())
+	{
+		DestroyTotal = 0;
+		DestroyedNum = 0;
+		return false;
+	}
+
+	return true;
+}
+
+bool UGameFeatureAction_SpawnActors::ParkActor(AActor* Actor)
+{
+	TArray<FPooledActor>& PooledActors = ActorPool.FindOrAdd({FObjectKey(Actor->GetWorld()), FObjectKey(Actor->GetClass())});
+
+	// Remove the actors destroyed by other sources before checking the pool size
+	PooledActors.RemoveAllSwap([](const FPooledActor& PooledActor)
+	{
+		return !PooledActor.Actor.IsValid();
+	});
+
+	if (MaxPooledActorsPerClass > 0 && PooledActors.Num() >= MaxPooledActorsPerClass)
+	{
+		return false;
+	}
+
+	FMFEA_EventLog::Record(EMFEA_EventAction::SpawnActors, EMFEA_EventKind::Park, Actor, Actor->GetClass());
+
+	// Keep the current state of the actor to restore exactly the same state when it is reused
+	PooledActors.Add({Actor, FPlatformTime::Seconds(), Actor->IsHidden(), Actor->GetActorEnableCollision(), Actor->IsActorTickEnabled()});
+
+	// Disable the actor while it is parked
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+
+	if (PooledActorLifetime > 0.f && !PoolTrimTickerHandle.IsValid())
+	{
+		PoolTrimTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UGameFeatureAction_SpawnActors::TrimActorPool),
+		                                                            FMath::Min(PooledActorLifetime, 1.f));
+	}
+
+	return true;
+}
+
+AActor* UGameFeatureAction_SpawnActors::ReusePooledActor(UWorld* World, const UClass* ActorClass, const FTransform& SpawnTransform)
+{
+	TArray<FPooledActor>* const PooledActors = ActorPool.Find({FObjectKey(World), FObjectKey(ActorClass)});
+	if (!PooledActors)
+	{
+		return nullptr;
+	}
+
+	while (!PooledActors->IsEmpty())
+	{
+		const FPooledActor PooledActor = PooledActors->Pop(MFEA_Containers::NoShrinking);
+
+		AActor* const Actor = PooledActor.Actor.Get();
+		if (!IsValid(Actor))
+		{
+			continue;
+		}
+
+		FMFEA_EventLog::Record(EMFEA_EventAction::SpawnActors, EMFEA_EventKind::Reuse, Actor, Actor->GetClass());
+
+		// Reset the transform and restore the state the actor had before being parked
+		Actor->SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+		Actor->SetActorHiddenInGame(PooledActor.bWasHidden);
+		Actor->SetActorEnableCollision(PooledActor.bHadCollision);
+		Actor->SetActorTickEnabled(PooledActor.bWasTickEnabled);
+
+		return Actor;
+	}
+
+	return nullptr;
+}
+
+bool UGameFeatureAction_SpawnActors::TrimActorPool([[maybe_unused]] float DeltaTime)
+{
+	const double ExpirationTime = FPlatformTime::Seconds() - PooledActorLifetime;
+
+	for (auto PoolIterator = ActorPool.CreateIterator(); PoolIterator; ++PoolIterator)
+	{
+		PoolIterator->Value.RemoveAllSwap([ExpirationTime](const FPooledActor& PooledActor)
+		{
+			if (!PooledActor.Actor.IsValid())
+			{
+				return true;
+			}
+
+			if (PooledActor.ParkedTime > ExpirationTime)
+			{
+				return false;
+			}
+
+			FMFEA_EventLog::Record(EMFEA_EventAction::SpawnActors, EMFEA_EventKind::Destroy, PooledActor.Actor.Get(), PooledActor.Actor->GetClass());
+
+			PooledActor.Actor->Destroy();
+			return true;
+		});
+
+		if (PoolIterator->Value.IsEmpty())
+		{
+			PoolIterator.RemoveCurrent();
+		}
+	}
+
+	if (ActorPool.IsEmpty() || PooledActorLifetime <= 0.f)
+	{
+		PoolTrimTickerHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void UGameFeatureAction_SpawnActors::EmptyActorPool()
+{
+	if (PoolTrimTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PoolTrimTickerHandle);
+		PoolTrimTickerHandle.Reset();
+	}
+
+	for (const TPair<TPair<FObjectKey, FObjectKey>, TArray<FPooledActor>>& PoolEntry : ActorPool)
+	{
+		for (const FPooledActor& PooledActor : PoolEntry.Value)
+		{
+			if (PooledActor.Actor.IsValid())
+			{
+				PooledActor.Actor->Destroy();
+			}
+		}
+	}
+
+	ActorPool.Empty();
+}
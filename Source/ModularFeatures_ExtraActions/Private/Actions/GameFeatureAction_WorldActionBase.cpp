@@ -0,0 +1,259 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#include "Actions/GameFeatureAction_WorldActionBase.h"
+#include "LogModularFeatures_ExtraActions.h"
+#include <Engine/GameInstance.h>
+#include <Engine/AssetManager.h>
+#include <Engine/StreamableManager.h>
+#include <UObject/ObjectSaveContext.h>
+
+#if WITH_EDITOR && ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+#include <Misc/DataValidation.h>
+#endif
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GameFeatureAction_WorldActionBase)
+#endif
+
+void UGameFeatureAction_WorldActionBase::OnGameFeatureActivating(FGameFeatureActivatingContext& Context)
+{
+	Super::OnGameFeatureActivating(Context);
+
+	if (!ensureAlways(ActiveRequests.IsEmpty()))
+	{
+		ResetExtension();
+	}
+
+	ActivationContext = Context;
+
+	TArray<FSoftObjectPath> AssetsToPreload;
+	GetAssetsToPreload(AssetsToPreload);
+
+	// Nothing to stream: we can extend the actors right away
+	if (AssetsToPreload.IsEmpty())
+	{
+		HandleAssetsPreloaded();
+		return;
+	}
+
+	// Request all soft references at once and postpone the actors extension until the handle completes, so the per-actor callbacks will not touch the disk
+	PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetsToPreload),
+	                                                                       FStreamableDelegate::CreateUObject(
+		                                                                       this, &UGameFeatureAction_WorldActionBase::HandleAssetsPreloaded),
+	                                                                       FStreamableManager::AsyncLoadHighPriority);
+
+	if (!PreloadHandle.IsValid())
+	{
+		UE_LOG(LogGameplayFeaturesExtraActions, Warning, TEXT("%s: Failed to request the assets preload of action %s."), *FString(__FUNCTION__),
+		       *GetName());
+
+		HandleAssetsPreloaded();
+	}
+}
+
+void UGameFeatureAction_WorldActionBase::OnGameFeatureDeactivating(FGameFeatureDeactivatingContext& Context)
+{
+	Super::OnGameFeatureDeactivating(Context);
+
+	FWorldDelegates::OnStartGameInstance.Remove(GameInstanceStartHandle);
+	ReleasePreloadHandle();
+}
+
+void UGameFeatureAction_WorldActionBase::PreSave(const FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+#if WITH_EDITOR
+	// Report the invalid configurations as cook errors
+	if (SaveContext.IsCooking())
+	{
+		TArray<FText> ValidationErrors;
+		ValidateActionData(ValidationErrors);
+
+		for (const FText& Error : ValidationErrors)
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions, Error, TEXT("%s: %s"), *GetPathName(), *Error.ToString());
+		}
+	}
+#endif
+}
+
+#if WITH_EDITOR
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+EDataValidationResult UGameFeatureAction_WorldActionBase::IsDataValid(FDataValidationContext& Context) const
+{
+	const EDataValidationResult Result = Super::IsDataValid(Context);
+
+	TArray<FText> ValidationErrors;
+	ValidateActionData(ValidationErrors);
+
+	for (const FText& Error : ValidationErrors)
+	{
+		Context.AddError(Error);
+	}
+
+	return ValidationErrors.IsEmpty() && Result != EDataValidationResult::Invalid ? EDataValidationResult::Valid : EDataValidationResult::Invalid;
+}
+#else
+EDataValidationResult UGameFeatureAction_WorldActionBase::IsDataValid(TArray<FText>& ValidationErrors)
+{
+	const EDataValidationResult Result = Super::IsDataValid(ValidationErrors);
+
+	const int32 PreviousErrorsNum = ValidationErrors.Num();
+	ValidateActionData(ValidationErrors);
+
+	return ValidationErrors.Num() == PreviousErrorsNum && Result != EDataValidationResult::Invalid
+		       ? EDataValidationResult::Valid
+		       : EDataValidationResult::Invalid;
+}
+#endif
+
+void UGameFeatureAction_WorldActionBase::ValidateRequiredTags(const TArray<FName>& RequiredTags, TArray<FText>& OutErrors)
+{
+	if (RequiredTags.Contains(NAME_None))
+	{
+		OutErrors.Add(FText::FromString(TEXT("Require Tags contains a None tag: the action will never be applied.")));
+	}
+}
+#endif
+
+void UGameFeatureAction_WorldActionBase::HandleAssetsPreloaded()
+{
+	OnAssetsPreloaded();
+
+	const FGameFeatureStateChangeContext StateChangeContext(ActivationContext);
+
+	// When the game instance starts, will perform the modular feature activation behavior
+	GameInstanceStartHandle = FWorldDelegates::OnStartGameInstance.AddUObject(this, &UGameFeatureAction_WorldActionBase::HandleGameInstanceStart,
+	                                                                          StateChangeContext);
+
+	// Useful to activate the feature even if the game instance has already started
+	for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+	{
+		if (!StateChangeContext.ShouldApplyToWorldContext(WorldContext))
+		{
+			continue;
+		}
+
+		AddToWorld(WorldContext);
+	}
+}
+
+void UGameFeatureAction_WorldActionBase::ReleasePreloadHandle()
+{
+	if (!PreloadHandle.IsValid())
+	{
+		return;
+	}
+
+	// Cancel the request if the feature was deactivated before the load completes, otherwise just release the loaded assets
+	if (PreloadHandle->IsLoadingInProgress())
+	{
+		PreloadHandle->CancelHandle();
+	}
+	else
+	{
+		PreloadHandle->ReleaseHandle();
+	}
+
+	PreloadHandle.Reset();
+}
+
+void UGameFeatureAction_WorldActionBase::ResetExtension()
+{
+	ActiveRequests.Empty();
+	ResetExtensionWork();
+}
+
+int32 UGameFeatureAction_WorldActionBase::GetPendingExtensionWorkNum() const
+{
+	return PendingAdditions.Num();
+}
+
+void UGameFeatureAction_WorldActionBase::QueueExtensionWork(const FMFEA_ExtensionContext& Context, const EExtensionWorkType WorkType)
+{
+	const FObjectKey ActorKey(Context.GetActor());
+
+	if (WorkType == EExtensionWorkType::Remove)
+	{
+		// Cancel the pending addition and remove right away, the actor might be destroyed before the next drain
+		PendingAdditions.Remove(ActorKey);
+		ProcessExtensionWork(Context, WorkType);
+		return;
+	}
+
+	UMFEA_ExtensionSubsystem* const ExtensionSubsystem = Context.Subsystem.Get();
+	if (!IsValid(ExtensionSubsystem) || !ExtensionSubsystem->ShouldDeferExtensionWork())
+	{
+		ProcessExtensionWork(Context, WorkType);
+		return;
+	}
+
+	// We don't want to repeat the addition
+	if (PendingAdditions.Contains(ActorKey))
+	{
+		return;
+	}
+
+	const uint32 Serial = ++ExtensionWorkSerial;
+	PendingAdditions.Add(ActorKey, Serial);
+	ExtensionSubsystem->QueueExtensionWork(this, Context, Serial);
+}
+
+void UGameFeatureAction_WorldActionBase::ProcessQueuedExtensionWork(const FMFEA_ExtensionContext& Context, const uint32 Serial)
+{
+	const FObjectKey ActorKey(Context.GetActor());
+
+	// Skip additions cancelled by a removal or by the reset of the action
+	if (const uint32* const PendingSerial = PendingAdditions.Find(ActorKey); !PendingSerial || *PendingSerial != Serial)
+	{
+		return;
+	}
+
+	PendingAdditions.Remove(ActorKey);
+
+	if (Context.Actor.IsValid())
+	{
+		ProcessExtensionWork(Context, EExtensionWorkType::Add);
+	}
+}
+
+void UGameFeatureAction_WorldActionBase::ResetExtensionWork()
+{
+	// The jobs left in the subsystem queue no longer match any pending addition
+	PendingAdditions.Empty();
+}
+
+void UGameFeatureAction_WorldActionBase::AddExtensionHandler(const FWorldContext& WorldContext, const TSoftClassPtr<AActor>& ReceiverClass)
+{
+	if (UMFEA_ExtensionSubsystem* const ExtensionSubsystem = GetExtensionSubsystem(WorldContext); IsValid(ExtensionSubsystem) && !ReceiverClass.
+		IsNull())
+	{
+		if (FMFEA_ExtensionRequestHandlePtr RequestHandle = ExtensionSubsystem->AddExtensionHandler(ReceiverClass, this))
+		{
+			ActiveRequests.Add(MoveTemp(RequestHandle));
+		}
+	}
+}
+
+UMFEA_ExtensionSubsystem* UGameFeatureAction_WorldActionBase::GetExtensionSubsystem(const FWorldContext& WorldContext) const
+{
+	if (!IsValid(WorldContext.World()) || !WorldContext.World()->IsGameWorld())
+	{
+		return nullptr;
+	}
+
+	return UGameInstance::GetSubsystem<UMFEA_ExtensionSubsystem>(WorldContext.OwningGameInstance);
+}
+
+void UGameFeatureAction_WorldActionBase::HandleGameInstanceStart(UGameInstance* GameInstance, const FGameFeatureStateChangeContext ChangeContext)
+{
+	if (!ChangeContext.ShouldApplyToWorldContext(*GameInstance->GetWorldContext()))
+	{
+		return;
+	}
+
+	AddToWorld(*GameInstance->GetWorldContext());
+}
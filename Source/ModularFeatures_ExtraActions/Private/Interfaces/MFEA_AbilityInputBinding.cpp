@@ -0,0 +1,252 @@
+﻿// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#include "Interfaces/MFEA_AbilityInputBinding.h"
+#include "MFEA_Settings.h"
+#include <UObject/ObjectKey.h>
+#include <UObject/UObjectGlobals.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(MFEA_AbilityInputBinding)
+#endif
+
+namespace MFEA_AbilityInputBinding_Internal
+{
+	enum class EBindingFunction : uint8
+	{
+		SetupByInput,
+		SetupBySpec,
+		SetupByTags,
+		SetupByClass,
+		Remove,
+		SetupBatch,
+		RemoveBatch,
+		Num
+	};
+
+	static FName GetBindingFunctionName(const EBindingFunction Function)
+	{
+		switch (Function)
+		{
+		case EBindingFunction::SetupByInput: return GET_FUNCTION_NAME_CHECKED(IMFEA_AbilityInputBinding, SetupAbilityBindingByInput);
+		case EBindingFunction::SetupBySpec: return GET_FUNCTION_NAME_CHECKED(IMFEA_AbilityInputBinding, SetupAbilityBindingBySpec);
+		case EBindingFunction::SetupByTags: return GET_FUNCTION_NAME_CHECKED(IMFEA_AbilityInputBinding, SetupAbilityBindingByTags);
+		case EBindingFunction::SetupByClass: return GET_FUNCTION_NAME_CHECKED(IMFEA_AbilityInputBinding, SetupAbilityBindingByClass);
+		case EBindingFunction::Remove: return GET_FUNCTION_NAME_CHECKED(IMFEA_AbilityInputBinding, RemoveAbilityInputBinding);
+		case EBindingFunction::SetupBatch: return GET_FUNCTION_NAME_CHECKED(IMFEA_BatchedAbilityInputBinding, SetupAbilityBindings);
+		case EBindingFunction::RemoveBatch: return GET_FUNCTION_NAME_CHECKED(IMFEA_BatchedAbilityInputBinding, RemoveAbilityInputBindings);
+		default: return NAME_None;
+		}
+	}
+
+	/* Bitmask of the binding functions that are not overridden in Blueprint for each class - Only accessed by the game thread */
+	static TMap<FObjectKey, uint8> NativeFunctionsByClass;
+
+#if WITH_EDITOR
+	static FDelegateHandle ObjectsReinstancedHandle;
+
+	/* Recompiled Blueprints are new classes: the masks of the replaced classes are dropped instead of being kept for the whole session */
+	static void HandleObjectsReinstanced(const TMap<UObject*, UObject*>& ReinstancedObjects)
+	{
+		for (const TPair<UObject*, UObject*>& ReinstancedObject : ReinstancedObjects)
+		{
+			if (Cast<UClass>(ReinstancedObject.Key))
+			{
+				NativeFunctionsByClass.Remove(ReinstancedObject.Key);
+			}
+		}
+	}
+#endif
+
+	/* Bitmask of the binding functions that are not overridden in Blueprint, resolved once per class */
+	static uint8 GetNativeBindingFunctions(const UClass* const Class)
+	{
+		check(IsInGameThread());
+
+		if (const uint8* const ExistingMask = NativeFunctionsByClass.Find(Class))
+		{
+			return *ExistingMask;
+		}
+
+		uint8 NativeMask = 0;
+		for (uint8 Index = 0; Index < static_cast<uint8>(EBindingFunction::Num); ++Index)
+		{
+			// A Blueprint override is a script function with the same name inside the generated class
+			if (const UFunction* const Function = Class->FindFunctionByName(GetBindingFunctionName(static_cast<EBindingFunction>(Index)));
+				!Function || Function->HasAnyFunctionFlags(FUNC_Native))
+			{
+				NativeMask |= 1 << Index;
+			}
+		}
+
+		return NativeFunctionsByClass.Add(Class, NativeMask);
+	}
+
+	/* Returns the native interface if the function can be called without reflection */
+	template <typename InterfaceType = IMFEA_AbilityInputBinding>
+	static InterfaceType* GetNativeInterface(UObject* const InterfaceOwner, const EBindingFunction Function)
+	{
+		InterfaceType* const Interface = Cast<InterfaceType>(InterfaceOwner);
+		if (Interface && (GetNativeBindingFunctions(InterfaceOwner->GetClass()) & (1 << static_cast<uint8>(Function))))
+		{
+			return Interface;
+		}
+
+		return nullptr;
+	}
+}
+
+void FMFEA_AbilityInputBindingDispatch::Initialize()
+{
+#if WITH_EDITOR
+	using namespace MFEA_AbilityInputBinding_Internal;
+	ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddStatic(&HandleObjectsReinstanced);
+#endif
+}
+
+void FMFEA_AbilityInputBindingDispatch::Shutdown()
+{
+	using namespace MFEA_AbilityInputBinding_Internal;
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+	ObjectsReinstancedHandle.Reset();
+#endif
+
+	NativeFunctionsByClass.Empty();
+}
+
+bool FMFEA_AbilityInputBindingDispatch::IsInterfaceOwner(const UObject* InterfaceOwner)
+{
+	if (!IsValid(InterfaceOwner))
+	{
+		return false;
+	}
+
+	const UClass* const OwnerClass = InterfaceOwner->GetClass();
+	return OwnerClass->ImplementsInterface(UMFEA_NativeAbilityInputBinding::StaticClass())
+		|| OwnerClass->ImplementsInterface(UMFEA_BatchedAbilityInputBinding::StaticClass())
+		|| OwnerClass->ImplementsInterface(UMFEA_AbilityInputBinding::StaticClass());
+}
+
+void FMFEA_AbilityInputBindingDispatch::SetupAbilityBindings(UObject* InterfaceOwner, const TArray<FMFEA_AbilityBindingEntry>& Bindings)
+{
+	using namespace MFEA_AbilityInputBinding_Internal;
+
+	if (IMFEA_NativeAbilityInputBinding* const NativeInterface = Cast<IMFEA_NativeAbilityInputBinding>(InterfaceOwner))
+	{
+		NativeInterface->SetupAbilityBindings(Bindings);
+	}
+	else if (IMFEA_BatchedAbilityInputBinding* const Interface =
+		GetNativeInterface<IMFEA_BatchedAbilityInputBinding>(InterfaceOwner, EBindingFunction::SetupBatch))
+	{
+		Interface->SetupAbilityBindings_Implementation(Bindings);
+	}
+	else if (InterfaceOwner->GetClass()->ImplementsInterface(UMFEA_BatchedAbilityInputBinding::StaticClass()))
+	{
+		IMFEA_BatchedAbilityInputBinding::Execute_SetupAbilityBindings(InterfaceOwner, Bindings);
+	}
+	else
+	{
+		// The owner only implements the single binding functions, as the Blueprints created before the batched interface
+		for (const FMFEA_AbilityBindingEntry& Binding : Bindings)
+		{
+			SetupAbilityBinding(InterfaceOwner, Binding);
+		}
+	}
+}
+
+void FMFEA_AbilityInputBindingDispatch::SetupAbilityBinding(UObject* InterfaceOwner, const FMFEA_AbilityBindingEntry& Binding)
+{
+	using namespace MFEA_AbilityInputBinding_Internal;
+
+	switch (UMFEA_Settings::Get()->AbilityBindingMode)
+	{
+	case EAbilityBindingMode::InputID:
+		if (IMFEA_AbilityInputBinding* const Interface = GetNativeInterface(InterfaceOwner, EBindingFunction::SetupByInput))
+		{
+			Interface->SetupAbilityBindingByInput_Implementation(Binding.Action, Binding.InputID);
+		}
+		else
+		{
+			IMFEA_AbilityInputBinding::Execute_SetupAbilityBindingByInput(InterfaceOwner, Binding.Action, Binding.InputID);
+		}
+		break;
+
+	case EAbilityBindingMode::AbilitySpec:
+		if (IMFEA_AbilityInputBinding* const Interface = GetNativeInterface(InterfaceOwner, EBindingFunction::SetupBySpec))
+		{
+			Interface->SetupAbilityBindingBySpec_Implementation(Binding.Action, Binding.AbilitySpec);
+		}
+		else
+		{
+			IMFEA_AbilityInputBinding::Execute_SetupAbilityBindingBySpec(InterfaceOwner, Binding.Action, Binding.AbilitySpec);
+		}
+		break;
+
+	case EAbilityBindingMode::AbilityTags:
+		if (IMFEA_AbilityInputBinding* const Interface = GetNativeInterface(InterfaceOwner, EBindingFunction::SetupByTags))
+		{
+			Interface->SetupAbilityBindingByTags_Implementation(Binding.Action, Binding.AbilityTags);
+		}
+		else
+		{
+			IMFEA_AbilityInputBinding::Execute_SetupAbilityBindingByTags(InterfaceOwner, Binding.Action, Binding.AbilityTags);
+		}
+		break;
+
+	case EAbilityBindingMode::AbilityClass:
+		if (IMFEA_AbilityInputBinding* const Interface = GetNativeInterface(InterfaceOwner, EBindingFunction::SetupByClass))
+		{
+			Interface->SetupAbilityBindingByClass_Implementation(Binding.Action, Binding.AbilityClass);
+		}
+		else
+		{
+			IMFEA_AbilityInputBinding::Execute_SetupAbilityBindingByClass(InterfaceOwner, Binding.Action, Binding.AbilityClass);
+		}
+		break;
+
+	default: break;
+	}
+}
+
+void FMFEA_AbilityInputBindingDispatch::RemoveAbilityInputBindings(UObject* InterfaceOwner, const TArray<UInputAction*>& Actions)
+{
+	using namespace MFEA_AbilityInputBinding_Internal;
+
+	if (IMFEA_NativeAbilityInputBinding* const NativeInterface = Cast<IMFEA_NativeAbilityInputBinding>(InterfaceOwner))
+	{
+		NativeInterface->RemoveAbilityInputBindings(Actions);
+	}
+	else if (IMFEA_BatchedAbilityInputBinding* const Interface =
+		GetNativeInterface<IMFEA_BatchedAbilityInputBinding>(InterfaceOwner, EBindingFunction::RemoveBatch))
+	{
+		Interface->RemoveAbilityInputBindings_Implementation(Actions);
+	}
+	else if (InterfaceOwner->GetClass()->ImplementsInterface(UMFEA_BatchedAbilityInputBinding::StaticClass()))
+	{
+		IMFEA_BatchedAbilityInputBinding::Execute_RemoveAbilityInputBindings(InterfaceOwner, Actions);
+	}
+	else
+	{
+		for (UInputAction* const Action : Actions)
+		{
+			RemoveAbilityInputBinding(InterfaceOwner, Action);
+		}
+	}
+}
+
+void FMFEA_AbilityInputBindingDispatch::RemoveAbilityInputBinding(UObject* InterfaceOwner, UInputAction* Action)
+{
+	using namespace MFEA_AbilityInputBinding_Internal;
+
+	if (IMFEA_AbilityInputBinding* const Interface = GetNativeInterface(InterfaceOwner, EBindingFunction::Remove))
+	{
+		Interface->RemoveAbilityInputBinding_Implementation(Action);
+	}
+	else
+	{
+		IMFEA_AbilityInputBinding::Execute_RemoveAbilityInputBinding(InterfaceOwner, Action);
+	}
+}
@@ -0,0 +1,126 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#include "MFEA_EventLog.h"
+#include "LogModularFeatures_ExtraActions.h"
+#include <HAL/IConsoleManager.h>
+#include <Misc/CoreDelegates.h>
+#include <Misc/DateTime.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+#include <atomic>
+
+namespace MFEA_EventLog_Internal
+{
+	static TArray<FMFEA_Event> Events;
+	static uint64 IndexMask = 0;
+	static std::atomic<uint64> NextIndex{0};
+	static FDelegateHandle SystemErrorHandle;
+
+	static const TCHAR* ActionNames[] = {TEXT("Abilities"), TEXT("Attribute"), TEXT("Effects"), TEXT("Inputs"), TEXT("SpawnActors")};
+	static const TCHAR* KindNames[] = {TEXT("Add"), TEXT("Remove"), TEXT("Bind"), TEXT("Spawn"), TEXT("Destroy"), TEXT("Park"), TEXT("Reuse")};
+	static const TCHAR* ResultNames[] = {TEXT("Success"), TEXT("Failed")};
+
+	static void DumpOnSystemError()
+	{
+		FMFEA_EventLog::Dump(FPaths::ProjectLogDir() / TEXT("MFEA-Events-Crash.log"), false);
+	}
+
+	static void DumpEvents(const TArray<FString>& Args)
+	{
+		const FString FileName = Args.IsEmpty() ? FString::Printf(TEXT("MFEA-Events-%s.log"), *FDateTime::Now().ToString()) : Args[0];
+		const FString FilePath = FPaths::ProjectLogDir() / FileName;
+
+		if (FMFEA_EventLog::Dump(FilePath, true))
+		{
+			UE_LOG(LogGameplayFeaturesExtraActions, Display, TEXT("MFEA.DumpEvents: Events written to %s."), *FilePath);
+		}
+	}
+
+	static FAutoConsoleCommand DumpEventsCommand(
+		TEXT("MFEA.DumpEvents"), TEXT("Write the recorded events to the log directory. Usage: MFEA.DumpEvents [FileName]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&DumpEvents));
+}
+
+void FMFEA_EventLog::Initialize(const int32 Capacity)
+{
+	using namespace MFEA_EventLog_Internal;
+
+	Shutdown();
+
+	if (Capacity <= 0)
+	{
+		return;
+	}
+
+	Events.SetNum(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(Capacity)));
+	IndexMask = Events.Num() - 1;
+	NextIndex = 0;
+
+	SystemErrorHandle = FCoreDelegates::OnHandleSystemError.AddStatic(&DumpOnSystemError);
+}
+
+void FMFEA_EventLog::Shutdown()
+{
+	using namespace MFEA_EventLog_Internal;
+
+	if (SystemErrorHandle.IsValid())
+	{
+		FCoreDelegates::OnHandleSystemError.Remove(SystemErrorHandle);
+		SystemErrorHandle.Reset();
+	}
+
+	Events.Empty();
+	IndexMask = 0;
+}
+
+void FMFEA_EventLog::Record(const EMFEA_EventAction Action, const EMFEA_EventKind Kind, const UObject* Actor, const UObject* Asset,
+                            const EMFEA_EventResult Result)
+{
+	using namespace MFEA_EventLog_Internal;
+
+	if (Events.IsEmpty())
+	{
+		return;
+	}
+
+	// Each writer owns its slot, the oldest events are overwritten when the buffer is full
+	FMFEA_Event& Event = Events[NextIndex.fetch_add(1, std::memory_order_relaxed) & IndexMask];
+	Event.Cycles = FPlatformTime::Cycles64();
+	Event.Actor = FObjectKey(Actor);
+	Event.Asset = Asset ? Asset->GetFName() : NAME_None;
+	Event.Action = Action;
+	Event.Kind = Kind;
+	Event.Result = Result;
+}
+
+bool FMFEA_EventLog::Dump(const FString& FilePath, const bool bResolveObjects)
+{
+	using namespace MFEA_EventLog_Internal;
+
+	if (Events.IsEmpty())
+	{
+		return false;
+	}
+
+	const uint64 EndIndex = NextIndex.load(std::memory_order_relaxed);
+	const uint64 StartIndex = EndIndex > static_cast<uint64>(Events.Num()) ? EndIndex - Events.Num() : 0;
+
+	FString Output = TEXT("Index,Seconds,Action,Kind,Result,Actor,Asset\n");
+	Output.Reserve(Output.Len() + static_cast<int32>(EndIndex - StartIndex) * 96);
+
+	for (uint64 Index = StartIndex; Index < EndIndex; ++Index)
+	{
+		const FMFEA_Event& Event = Events[Index & IndexMask];
+
+		const UObject* const Actor = bResolveObjects ? Event.Actor.ResolveObjectPtrEvenIfPendingKill() : nullptr;
+		const FString ActorName = Actor ? Actor->GetName() : FString::Printf(TEXT("%08x"), GetTypeHash(Event.Actor));
+
+		Output += FString::Printf(TEXT("%llu,%.6f,%s,%s,%s,%s,%s\n"), Index, FPlatformTime::ToSeconds64(Event.Cycles),
+		                          ActionNames[static_cast<uint8>(Event.Action)], KindNames[static_cast<uint8>(Event.Kind)],
+		                          ResultNames[static_cast<uint8>(Event.Result)], *ActorName, *Event.Asset.ToString());
+	}
+
+	return FFileHelper::SaveStringToFile(Output, *FilePath);
+}
@@ -0,0 +1,628 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#include "MFEA_ExtensionSubsystem.h"
+#include "Actions/GameFeatureAction_WorldActionBase.h"
+#include "ModularFeatures_InternalFuncs.h"
+#include "MFEA_Stats.h"
+#include "MFEA_Settings.h"
+#include "MFEA_Containers.h"
+#include <AbilitySystemComponent.h>
+#include <EnhancedInputSubsystems.h>
+#include <InputMappingContext.h>
+#include <Engine/LocalPlayer.h>
+#include <Engine/GameInstance.h>
+#include <HAL/IConsoleManager.h>
+#include <Misc/CoreDelegates.h>
+#include <Misc/DateTime.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+#include <Dom/JsonObject.h>
+#include <Serialization/JsonSerializer.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(MFEA_ExtensionSubsystem)
+#endif
+
+DECLARE_CYCLE_STAT(TEXT("Handle Actor Extension"), STAT_MFEA_HandleActorExtension, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Drain Extension Work"), STAT_MFEA_DrainExtensionWork, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Commit Ability System Transaction"), STAT_MFEA_CommitTransaction, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Flush Replication"), STAT_MFEA_FlushReplication, STATGROUP_MFEA);
+DECLARE_CYCLE_STAT(TEXT("Flush Mapping Contexts"), STAT_MFEA_FlushMappingContexts, STATGROUP_MFEA);
+
+namespace MFEA_ExtensionSubsystem_Internal
+{
+	static UMFEA_ExtensionSubsystem* GetSubsystemFromWorld(const UWorld* World)
+	{
+		return IsValid(World) ? UGameInstance::GetSubsystem<UMFEA_ExtensionSubsystem>(World->GetGameInstance()) : nullptr;
+	}
+
+	static void WriteReport(const TArray<FString>& Args, UWorld* World, FOutputDevice& Output)
+	{
+		const UMFEA_ExtensionSubsystem* const ExtensionSubsystem = GetSubsystemFromWorld(World);
+		if (!IsValid(ExtensionSubsystem))
+		{
+			Output.Log(TEXT("MFEA.WriteReport: No extension subsystem found."));
+			return;
+		}
+
+		const FString FileName = Args.IsEmpty() ? FString::Printf(TEXT("Report-%s.json"), *FDateTime::Now().ToString()) : Args[0];
+		const FString FilePath = FPaths::ProfilingDir() / TEXT("MFEA") / FileName;
+
+		if (FFileHelper::SaveStringToFile(ExtensionSubsystem->MakeReport(), *FilePath))
+		{
+			Output.Logf(TEXT("MFEA.WriteReport: Report written to %s."), *FilePath);
+		}
+		else
+		{
+			Output.Logf(TEXT("MFEA.WriteReport: Failed to write %s."), *FilePath);
+		}
+	}
+
+	static void ResetReport([[maybe_unused]] const TArray<FString>& Args, UWorld* World, FOutputDevice& Output)
+	{
+		if (UMFEA_ExtensionSubsystem* const ExtensionSubsystem = GetSubsystemFromWorld(World))
+		{
+			ExtensionSubsystem->ResetReportCounters();
+			Output.Log(TEXT("MFEA.ResetReport: Counters reset."));
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice WriteReportCommand(
+		TEXT("MFEA.WriteReport"), TEXT("Write the extension report to the profiling directory. Usage: MFEA.WriteReport [FileName]"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&WriteReport));
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice ResetReportCommand(
+		TEXT("MFEA.ResetReport"), TEXT("Reset the counters of the extension report."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&ResetReport));
+}
+
+void FMFEA_AbilitySystemTransaction::Execute(const EPhase Phase, TFunction<void()>&& Change)
+{
+	if (bCommitted)
+	{
+		Change();
+		return;
+	}
+
+	Changes[static_cast<uint8>(Phase)].Add(MoveTemp(Change));
+}
+
+void FMFEA_AbilitySystemTransaction::Commit()
+{
+	SCOPE_CYCLE_COUNTER(STAT_MFEA_CommitTransaction);
+
+	// Changes recorded during the commit are performed right away
+	bCommitted = true;
+
+	for (TArray<TFunction<void()>>& PhaseChanges : Changes)
+	{
+		// Move the changes out to release the captured data once performed
+		const TArray<TFunction<void()>> ChangesToPerform = MoveTemp(PhaseChanges);
+		for (const TFunction<void()>& Change : ChangesToPerform)
+		{
+			Change();
+		}
+	}
+}
+
+void FMFEA_ExtensionContext::ExecuteInTransaction(const FMFEA_AbilitySystemTransaction::EPhase Phase, TFunction<void()>&& Change) const
+{
+	if (Transaction.IsValid())
+	{
+		Transaction->Execute(Phase, MoveTemp(Change));
+	}
+	else
+	{
+		Change();
+	}
+}
+
+FMFEA_ExtensionRequestHandle::FMFEA_ExtensionRequestHandle(UMFEA_ExtensionSubsystem* InSubsystem, const FSoftObjectPath& InReceiverClass,
+                                                           UGameFeatureAction_WorldActionBase* InAction) : Subsystem(InSubsystem),
+	ReceiverClass(InReceiverClass), Action(InAction)
+{
+}
+
+FMFEA_ExtensionRequestHandle::~FMFEA_ExtensionRequestHandle()
+{
+	if (UMFEA_ExtensionSubsystem* const ExtensionSubsystem = Subsystem.Get())
+	{
+		ExtensionSubsystem->RemoveExtensionHandler(ReceiverClass, Action.Get(true));
+	}
+}
+
+void UMFEA_ExtensionSubsystem::Deinitialize()
+{
+	ResetExtensionWork();
+
+	// Move the extensions out before releasing the component manager requests, which send the removal events back to this subsystem
+	{
+		const TMap<FSoftObjectPath, FClassExtension> ReleasedExtensions = MoveTemp(ClassExtensions);
+		ClassExtensions.Reset();
+	}
+
+	// Don't leave pending changes behind, the components and local players can still be alive after the game instance
+	FlushEndFrame();
+
+	Super::Deinitialize();
+}
+
+FMFEA_ExtensionRequestHandlePtr UMFEA_ExtensionSubsystem::AddExtensionHandler(const TSoftClassPtr<AActor>& ReceiverClass,
+                                                                              UGameFeatureAction_WorldActionBase* Action)
+{
+	if (ReceiverClass.IsNull() || !IsValid(Action))
+	{
+		return nullptr;
+	}
+
+	const FSoftObjectPath ClassPath = ReceiverClass.ToSoftObjectPath();
+
+	if (FClassExtension* const ExistingExtension = ClassExtensions.Find(ClassPath))
+	{
+		ExistingExtension->Actions.AddUnique(Action);
+
+		// The component manager will not send the events again for the actors that are already registered, so we replay the addition only to the new action
+		TArray<TWeakObjectPtr<AActor>> Receivers;
+		ExistingExtension->Receivers.GenerateValueArray(Receivers);
+
+		const TWeakObjectPtr<UGameFeatureAction_WorldActionBase> NewAction(Action);
+
+		for (const TWeakObjectPtr<AActor>& Receiver : Receivers)
+		{
+			if (AActor* const Actor = Receiver.Get())
+			{
+				DispatchExtensionEvent(MakeExtensionContext(Actor, UGameFrameworkComponentManager::NAME_ExtensionAdded), MakeArrayView(&NewAction, 1));
+			}
+		}
+	}
+	else if (UGameFrameworkComponentManager* const ComponentManager = UGameInstance::GetSubsystem<UGameFrameworkComponentManager>(GetGameInstance()))
+	{
+		// Add the action before the request since the component manager sends the events of the existing actors during the registration
+		ClassExtensions.Add(ClassPath).Actions.Add(Action);
+
+		using FHandlerDelegate = UGameFrameworkComponentManager::FExtensionHandlerDelegate;
+		const FHandlerDelegate ExtensionHandlerDelegate = FHandlerDelegate::CreateUObject(this, &UMFEA_ExtensionSubsystem::HandleActorExtension, ClassPath);
+
+		TSharedPtr<FComponentRequestHandle> ComponentRequest = ComponentManager->AddExtensionHandler(ReceiverClass, ExtensionHandlerDelegate);
+
+		if (FClassExtension* const NewExtension = ClassExtensions.Find(ClassPath))
+		{
+			NewExtension->ComponentRequest = MoveTemp(ComponentRequest);
+		}
+
+		UE_LOG(LogGameplayFeaturesExtraActions_Internal, Display, TEXT("%s: Registered extension handler for class %s."), *FString(__FUNCTION__),
+		       *ClassPath.ToString());
+	}
+	else
+	{
+		return nullptr;
+	}
+
+	return MakeShared<FMFEA_ExtensionRequestHandle>(this, ClassPath, Action);
+}
+
+int32 UMFEA_ExtensionSubsystem::GetNumReceiverClasses() const
+{
+	return ClassExtensions.Num();
+}
+
+bool UMFEA_ExtensionSubsystem::ShouldDeferExtensionWork() const
+{
+	// Keep the order of the events: while older additions are waiting, the new ones are queued even without budget
+	return UMFEA_Settings::Get()->ExtensionFrameBudget > 0.f || ExtensionWorkHead < PendingExtensionWork.Num();
+}
+
+void UMFEA_ExtensionSubsystem::QueueExtensionWork(UGameFeatureAction_WorldActionBase* Action, const FMFEA_ExtensionContext& Context, const uint32 Serial)
+{
+	const bool bIsDispatchingContext = &Context == DispatchingContext;
+
+	int32 WorkIndex = bIsDispatchingContext ? DispatchingWorkIndex : INDEX_NONE;
+	if (WorkIndex == INDEX_NONE)
+	{
+		WorkIndex = PendingExtensionWork.Add({Context});
+
+		if (bIsDispatchingContext)
+		{
+			DispatchingWorkIndex = WorkIndex;
+		}
+	}
+
+	PendingExtensionWork[WorkIndex].Actions.Add({Action, Serial});
+
+	if (!ExtensionWorkTickerHandle.IsValid())
+	{
+		ExtensionWorkTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UMFEA_ExtensionSubsystem::DrainExtensionWork));
+	}
+}
+
+int32 UMFEA_ExtensionSubsystem::GetPendingExtensionWorkNum() const
+{
+	return PendingExtensionWork.Num() - ExtensionWorkHead;
+}
+
+bool UMFEA_ExtensionSubsystem::DrainExtensionWork([[maybe_unused]] float DeltaTime)
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_DrainExtensionWork, nullptr, nullptr);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// A budget of 0, e.g. if it was disabled while additions were waiting, processes the whole queue
+	const float FrameBudgetMs = UMFEA_Settings::Get()->ExtensionFrameBudget;
+	const double FrameBudget = FrameBudgetMs / 1000.0;
+
+	int32 ProcessedNum = 0;
+	while (ExtensionWorkHead < PendingExtensionWork.Num())
+	{
+		// Always process at least one job to guarantee the progress of the queue
+		if (ProcessedNum > 0 && FrameBudgetMs > 0.f && FPlatformTime::Seconds() - StartTime >= FrameBudget)
+		{
+			break;
+		}
+
+		// Move the job out since the processing can push new jobs into the queue
+		const FExtensionWork Work = MoveTemp(PendingExtensionWork[ExtensionWorkHead++]);
+		++ProcessedNum;
+
+		for (const FQueuedAction& QueuedAction : Work.Actions)
+		{
+			if (UGameFeatureAction_WorldActionBase* const Action = QueuedAction.Action.Get())
+			{
+				Action->ProcessQueuedExtensionWork(Work.Context, QueuedAction.Serial);
+			}
+		}
+
+		// The changes of all actions queued for this event are committed together, in the same order as the events processed without budget
+		if (Work.Context.Transaction.IsValid())
+		{
+			Work.Context.Transaction->Commit();
+		}
+	}
+
+	LastExtensionDrainTime = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	UE_LOG(LogGameplayFeaturesExtraActions_Internal, Display, TEXT("%s: Processed %d extension events in %f ms, %d remaining."), *FString(__FUNCTION__),
+	       ProcessedNum, LastExtensionDrainTime, GetPendingExtensionWorkNum());
+
+	if (ExtensionWorkHead == PendingExtensionWork.Num())
+	{
+		PendingExtensionWork.Reset();
+		ExtensionWorkHead = 0;
+		ExtensionWorkTickerHandle.Reset();
+		return false;
+	}
+
+	// Only move the remaining jobs to the front once the processed ones take most of the queue
+	if (ExtensionWorkHead >= 64 && ExtensionWorkHead * 2 >= PendingExtensionWork.Num())
+	{
+		PendingExtensionWork.RemoveAt(0, ExtensionWorkHead, MFEA_Containers::NoShrinking);
+		ExtensionWorkHead = 0;
+	}
+
+	return true;
+}
+
+void UMFEA_ExtensionSubsystem::ResetExtensionWork()
+{
+	if (ExtensionWorkTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ExtensionWorkTickerHandle);
+		ExtensionWorkTickerHandle.Reset();
+	}
+
+	PendingExtensionWork.Empty();
+	ExtensionWorkHead = 0;
+}
+
+void UMFEA_ExtensionSubsystem::MarkReplicationDirty(UAbilitySystemComponent* AbilitySystemComponent)
+{
+	if (!IsValid(AbilitySystemComponent))
+	{
+		return;
+	}
+
+	UMFEA_ExtensionSubsystem* const ExtensionSubsystem = MFEA_ExtensionSubsystem_Internal::GetSubsystemFromWorld(AbilitySystemComponent->GetWorld());
+
+	if (!IsValid(ExtensionSubsystem))
+	{
+		AbilitySystemComponent->ForceReplication();
+		return;
+	}
+
+	ExtensionSubsystem->DirtyAbilitySystemComponents.Add(AbilitySystemComponent);
+	ExtensionSubsystem->RequestEndFrameFlush();
+}
+
+void UMFEA_ExtensionSubsystem::QueueMappingContextChange(UEnhancedInputLocalPlayerSubsystem* InputSubsystem, UInputMappingContext* MappingContext,
+                                                         const int32 Priority, const bool bAdd)
+{
+	if (!IsValid(InputSubsystem) || !IsValid(MappingContext))
+	{
+		return;
+	}
+
+	const ULocalPlayer* const LocalPlayer = InputSubsystem->GetLocalPlayer<ULocalPlayer>();
+	UMFEA_ExtensionSubsystem* const ExtensionSubsystem = IsValid(LocalPlayer)
+		                                                     ? UGameInstance::GetSubsystem<UMFEA_ExtensionSubsystem>(LocalPlayer->GetGameInstance())
+		                                                     : nullptr;
+
+	if (!IsValid(ExtensionSubsystem))
+	{
+		if (bAdd)
+		{
+			InputSubsystem->AddMappingContext(MappingContext, Priority);
+		}
+		else
+		{
+			InputSubsystem->RemoveMappingContext(MappingContext);
+		}
+
+		return;
+	}
+
+	TArray<FMappingContextChange>& Changes = ExtensionSubsystem->PendingMappingContextChanges.FindOrAdd(InputSubsystem);
+
+	// Applying only the last change of the context results in the same mappings as applying all of them in order
+	if (FMappingContextChange* const ExistingChange = Changes.FindByPredicate([MappingContext](const FMappingContextChange& Item)
+	{
+		return Item.MappingContext == MappingContext;
+	}))
+	{
+		ExistingChange->Priority = Priority;
+		ExistingChange->bAdd = bAdd;
+	}
+	else
+	{
+		Changes.Add({MappingContext, Priority, bAdd});
+	}
+
+	ExtensionSubsystem->RequestEndFrameFlush();
+}
+
+void UMFEA_ExtensionSubsystem::RequestEndFrameFlush()
+{
+	if (!EndFrameHandle.IsValid())
+	{
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UMFEA_ExtensionSubsystem::FlushEndFrame);
+	}
+}
+
+void UMFEA_ExtensionSubsystem::FlushEndFrame()
+{
+	if (EndFrameHandle.IsValid())
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		EndFrameHandle.Reset();
+	}
+
+	FlushMappingContexts();
+	FlushReplication();
+}
+
+void UMFEA_ExtensionSubsystem::FlushMappingContexts()
+{
+	SCOPE_CYCLE_COUNTER(STAT_MFEA_FlushMappingContexts);
+
+	// Don't force the rebuild: all changes of a player are merged into a single rebuild of its mappings
+	FModifyContextOptions Options;
+	Options.bForceImmediately = false;
+
+	for (const TPair<TWeakObjectPtr<UEnhancedInputLocalPlayerSubsystem>, TArray<FMappingContextChange>>& PlayerChanges : PendingMappingContextChanges)
+	{
+		UEnhancedInputLocalPlayerSubsystem* const InputSubsystem = PlayerChanges.Key.Get();
+		if (!IsValid(InputSubsystem))
+		{
+			continue;
+		}
+
+		for (const FMappingContextChange& Change : PlayerChanges.Value)
+		{
+			if (const UInputMappingContext* const MappingContext = Change.MappingContext.Get())
+			{
+				if (Change.bAdd)
+				{
+					InputSubsystem->AddMappingContext(MappingContext, Change.Priority, Options);
+				}
+				else
+				{
+					InputSubsystem->RemoveMappingContext(MappingContext, Options);
+				}
+			}
+		}
+	}
+
+	PendingMappingContextChanges.Reset();
+}
+
+void UMFEA_ExtensionSubsystem::FlushReplication()
+{
+	SCOPE_CYCLE_COUNTER(STAT_MFEA_FlushReplication);
+
+	// With push model, the attribute set changes were already marked dirty by the component: this only schedules the net update
+	for (const TWeakObjectPtr<UAbilitySystemComponent>& AbilitySystemComponent : DirtyAbilitySystemComponents)
+	{
+		if (AbilitySystemComponent.IsValid())
+		{
+			AbilitySystemComponent->ForceReplication();
+		}
+	}
+
+	DirtyAbilitySystemComponents.Reset();
+}
+
+FString UMFEA_ExtensionSubsystem::MakeReport() const
+{
+	const TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetStringField(TEXT("Time"), FDateTime::UtcNow().ToIso8601());
+
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	Report->SetNumberField(TEXT("UsedPhysicalMB"), static_cast<double>(MemoryStats.UsedPhysical) / (1024.0 * 1024.0));
+	Report->SetNumberField(TEXT("PeakUsedPhysicalMB"), static_cast<double>(MemoryStats.PeakUsedPhysical) / (1024.0 * 1024.0));
+	Report->SetNumberField(TEXT("NumPendingExtensionEvents"), GetPendingExtensionWorkNum());
+	Report->SetNumberField(TEXT("LastDrainTimeMs"), LastExtensionDrainTime);
+
+	TArray<TSharedPtr<FJsonValue>> ClassReports;
+	for (const TPair<FSoftObjectPath, FClassExtension>& ClassExtension : ClassExtensions)
+	{
+		const FClassExtension& Extension = ClassExtension.Value;
+		const uint64 NumEvents = Extension.NumAdditionEvents + Extension.NumRemovalEvents;
+
+		const TSharedRef<FJsonObject> ClassReport = MakeShared<FJsonObject>();
+		ClassReport->SetStringField(TEXT("ReceiverClass"), ClassExtension.Key.ToString());
+		ClassReport->SetNumberField(TEXT("NumReceivers"), Extension.Receivers.Num());
+		ClassReport->SetNumberField(TEXT("NumAdditionEvents"), static_cast<double>(Extension.NumAdditionEvents));
+		ClassReport->SetNumberField(TEXT("NumRemovalEvents"), static_cast<double>(Extension.NumRemovalEvents));
+		ClassReport->SetNumberField(TEXT("TotalDispatchTimeMs"), Extension.TotalDispatchTime);
+		ClassReport->SetNumberField(TEXT("AverageDispatchTimeMs"), NumEvents != 0 ? Extension.TotalDispatchTime / NumEvents : 0.0);
+		ClassReport->SetNumberField(TEXT("PeakDispatchTimeMs"), Extension.PeakDispatchTime);
+
+		TArray<TSharedPtr<FJsonValue>> ActionReports;
+		for (const TWeakObjectPtr<UGameFeatureAction_WorldActionBase>& Action : Extension.Actions)
+		{
+			if (const UGameFeatureAction_WorldActionBase* const TargetAction = Action.Get())
+			{
+				const TSharedRef<FJsonObject> ActionReport = MakeShared<FJsonObject>();
+				ActionReport->SetStringField(TEXT("Feature"), GetNameSafe(TargetAction->GetOuter()));
+				ActionReport->SetStringField(TEXT("Action"), TargetAction->GetClass()->GetName());
+				ActionReport->SetNumberField(TEXT("NumExtendedActors"), TargetAction->GetNumExtendedActors());
+				ActionReport->SetNumberField(TEXT("NumPendingExtensions"), TargetAction->GetPendingExtensionWorkNum());
+
+				ActionReports.Add(MakeShared<FJsonValueObject>(ActionReport));
+			}
+		}
+
+		ClassReport->SetArrayField(TEXT("Actions"), ActionReports);
+		ClassReports.Add(MakeShared<FJsonValueObject>(ClassReport));
+	}
+
+	Report->SetArrayField(TEXT("ReceiverClasses"), ClassReports);
+
+	FString ReportString;
+	FJsonSerializer::Serialize(Report, TJsonWriterFactory<>::Create(&ReportString));
+
+	return ReportString;
+}
+
+void UMFEA_ExtensionSubsystem::ResetReportCounters()
+{
+	for (TPair<FSoftObjectPath, FClassExtension>& ClassExtension : ClassExtensions)
+	{
+		ClassExtension.Value.NumAdditionEvents = 0;
+		ClassExtension.Value.NumRemovalEvents = 0;
+		ClassExtension.Value.TotalDispatchTime = 0.0;
+		ClassExtension.Value.PeakDispatchTime = 0.0;
+	}
+}
+
+void UMFEA_ExtensionSubsystem::RemoveExtensionHandler(const FSoftObjectPath& ReceiverClass, const UGameFeatureAction_WorldActionBase* Action)
+{
+	FClassExtension* const ClassExtension = ClassExtensions.Find(ReceiverClass);
+	if (!ClassExtension)
+	{
+		return;
+	}
+
+	// The action tears down its own extensions when reset, so we don't send removal events to it
+	ClassExtension->Actions.RemoveAll([Action](const TWeakObjectPtr<UGameFeatureAction_WorldActionBase>& Item)
+	{
+		return !Item.IsValid() || Item.Get() == Action;
+	});
+
+	if (!ClassExtension->Actions.IsEmpty())
+	{
+		return;
+	}
+
+	// No more actions interested in this class: release the component manager request
+	const TSharedPtr<FComponentRequestHandle> ComponentRequest = MoveTemp(ClassExtension->ComponentRequest);
+	ClassExtensions.Remove(ReceiverClass);
+
+	UE_LOG(LogGameplayFeaturesExtraActions_Internal, Display, TEXT("%s: Unregistered extension handler for class %s."), *FString(__FUNCTION__),
+	       *ReceiverClass.ToString());
+}
+
+void UMFEA_ExtensionSubsystem::HandleActorExtension(AActor* Actor, const FName EventName, const FSoftObjectPath ReceiverClass)
+{
+	MFEA_SCOPE_CYCLE_COUNTER(STAT_MFEA_HandleActorExtension, nullptr, Actor);
+
+	FClassExtension* const ClassExtension = ClassExtensions.Find(ReceiverClass);
+	if (!ClassExtension || !Actor)
+	{
+		return;
+	}
+
+	FMFEA_ExtensionContext Context = MakeExtensionContext(Actor, EventName);
+
+	if (Context.IsAdditionEvent())
+	{
+		ClassExtension->Receivers.Add(FObjectKey(Actor), Actor);
+
+		// All actions record their changes to the ability system component, which are committed once the event was sent to all of them
+		if (Context.bHasAuthority && Context.AbilitySystemComponent.IsValid())
+		{
+			Context.Transaction = MakeShared<FMFEA_AbilitySystemTransaction>();
+		}
+	}
+	else if (Context.IsRemovalEvent())
+	{
+		ClassExtension->Receivers.Remove(FObjectKey(Actor));
+	}
+
+	const double DispatchStartTime = FPlatformTime::Seconds();
+
+	// Copy the actions since they can register or unregister themselves during the dispatch
+	const TArray<TWeakObjectPtr<UGameFeatureAction_WorldActionBase>, TInlineAllocator<16>> Actions(ClassExtension->Actions);
+	DispatchExtensionEvent(Context, Actions);
+
+	// The class extension can be removed by the actions during the dispatch
+	if (FClassExtension* const DispatchedExtension = ClassExtensions.Find(ReceiverClass))
+	{
+		const double DispatchTime = (FPlatformTime::Seconds() - DispatchStartTime) * 1000.0;
+
+		DispatchedExtension->NumAdditionEvents += Context.IsAdditionEvent() ? 1 : 0;
+		DispatchedExtension->NumRemovalEvents += Context.IsRemovalEvent() ? 1 : 0;
+		DispatchedExtension->TotalDispatchTime += DispatchTime;
+		DispatchedExtension->PeakDispatchTime = FMath::Max(DispatchedExtension->PeakDispatchTime, DispatchTime);
+	}
+}
+
+void UMFEA_ExtensionSubsystem::DispatchExtensionEvent(const FMFEA_ExtensionContext& Context,
+                                                      const TConstArrayView<TWeakObjectPtr<UGameFeatureAction_WorldActionBase>> Actions)
+{
+	// The additions queued by the actions during this dispatch are grouped in a single job
+	TGuardValue<const FMFEA_ExtensionContext*> DispatchingContextGuard(DispatchingContext, &Context);
+	TGuardValue<int32> DispatchingWorkIndexGuard(DispatchingWorkIndex, INDEX_NONE);
+
+	for (const TWeakObjectPtr<UGameFeatureAction_WorldActionBase>& Action : Actions)
+	{
+		if (UGameFeatureAction_WorldActionBase* const TargetAction = Action.Get())
+		{
+			TargetAction->HandleActorExtension(Context);
+		}
+	}
+
+	// If the additions were queued, the transaction is committed once the queued job is processed
+	if (Context.Transaction.IsValid() && DispatchingWorkIndex == INDEX_NONE)
+	{
+		Context.Transaction->Commit();
+	}
+}
+
+FMFEA_ExtensionContext UMFEA_ExtensionSubsystem::MakeExtensionContext(AActor* Actor, const FName EventName)
+{
+	FMFEA_ExtensionContext Context;
+	Context.Actor = Actor;
+	Context.EventName = EventName;
+	Context.Subsystem = this;
+	Context.bHasAuthority = IsValid(Actor) && Actor->GetLocalRole() == ROLE_Authority;
+
+	// The ability system component and the tags are only needed to extend the actor, the removals use the data that was recorded in the extension
+	if (Context.IsAdditionEvent() && IsValid(Actor))
+	{
+		Context.AbilitySystemComponent = ModularFeaturesHelper::GetAbilitySystemComponentInActor(Actor);
+		Context.ActorTags = FMFEA_TagSignature::MakeFromActor(Actor);
+	}
+
+	return Context;
+}
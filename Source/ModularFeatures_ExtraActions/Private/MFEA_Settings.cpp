@@ -0,0 +1,125 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#pragma once
+
+#include "MFEA_Settings.h"
+#include "LogModularFeatures_ExtraActions.h"
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(MFEA_Settings)
+#endif
+
+UMFEA_Settings::UMFEA_Settings(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer), bEnableAbilityAutoBinding(false),
+                                                                              bEnableInternalLogs(false),
+                                                                              AbilityBindingMode(EAbilityBindingMode::InputID),
+                                                                              InputBindingOwner(EInputBindingOwner::Controller),
+                                                                              ExtensionFrameBudget(0.f),
+                                                                              EventLogCapacity(4096)
+{
+	CategoryName = TEXT("Plugins");
+}
+
+const UMFEA_Settings* UMFEA_Settings::Get()
+{
+	static const UMFEA_Settings* const Instance = GetDefault<UMFEA_Settings>();
+	return Instance;
+}
+
+#if WITH_EDITOR
+void UMFEA_Settings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UMFEA_Settings, bEnableInternalLogs))
+	{
+		ToggleInternalLogs();
+	}
+	else if (PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UMFEA_Settings, InputIDEnumeration) || PropertyChangedEvent.
+		Property->GetFName() == GET_MEMBER_NAME_CHECKED(UMFEA_Settings, AbilityBindingMode))
+	{
+		InvalidateInputIDTable();
+	}
+}
+#endif
+
+void UMFEA_Settings::PostInitProperties()
+{
+	Super::PostInitProperties();
+	ToggleInternalLogs();
+}
+
+void UMFEA_Settings::ToggleInternalLogs()
+{
+#if !UE_BUILD_SHIPPING
+	LogGameplayFeaturesExtraActions_Internal.SetVerbosity(bEnableInternalLogs ? ELogVerbosity::Display : ELogVerbosity::NoLogging);
+#endif
+}
+
+int32 UMFEA_Settings::GetInputIDByName(const FName ValueName) const
+{
+	if (AbilityBindingMode != EAbilityBindingMode::InputID)
+	{
+		return INDEX_NONE;
+	}
+
+	if (!bInputIDTableBuilt)
+	{
+		BuildInputIDTable();
+	}
+
+	const int32* const InputID = InputIDTable.Find(ValueName);
+	return InputID ? *InputID : INDEX_NONE;
+}
+
+void UMFEA_Settings::BuildInputIDTable() const
+{
+	check(IsInGameThread());
+
+	InputIDTable.Reset();
+	bInputIDTableBuilt = true;
+
+	if (InputIDEnumeration.IsNull())
+	{
+		UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: AbilityBindingMode is set to InputID but Enumeration class is null!"),
+		       *FString(__FUNCTION__));
+		return;
+	}
+
+	// Only loads from disk if no action preloaded the enumeration
+	const UEnum* const Enumeration = InputIDEnumeration.LoadSynchronous();
+	if (!IsValid(Enumeration))
+	{
+		UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Failed to load the InputID Enumeration %s."), *FString(__FUNCTION__),
+		       *InputIDEnumeration.ToString());
+		return;
+	}
+
+	// Same names accepted by UEnum::GetValueByName with CheckAuthoredName: full name, short name and authored name, the first match is kept
+	for (int32 Index = 0; Index < Enumeration->NumEnums(); ++Index)
+	{
+		const int32 Value = static_cast<int32>(Enumeration->GetValueByIndex(Index));
+
+		const FName ValueNames[] = {
+			Enumeration->GetNameByIndex(Index), FName(*Enumeration->GetNameStringByIndex(Index)), FName(*Enumeration->GetAuthoredNameStringByIndex(Index))
+		};
+
+		for (const FName& ValueName : ValueNames)
+		{
+			if (!InputIDTable.Contains(ValueName))
+			{
+				InputIDTable.Add(ValueName, Value);
+			}
+		}
+	}
+
+	UE_LOG(LogGameplayFeaturesExtraActions_Internal, Display, TEXT("%s: Built InputID table with %d names from %s."), *FString(__FUNCTION__),
+	       InputIDTable.Num(), *Enumeration->GetName());
+}
+
+void UMFEA_Settings::InvalidateInputIDTable() const
+{
+	InputIDTable.Empty();
+	bInputIDTableBuilt = false;
+}
@@ -0,0 +1,7 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#include "MFEA_Stats.h"
+
+UE_TRACE_CHANNEL_DEFINE(MFEAChannel);
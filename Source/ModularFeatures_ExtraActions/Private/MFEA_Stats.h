@@ -0,0 +1,57 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Stats/Stats.h>
+#include <Trace/Trace.h>
+#include <ProfilingDebugging/CpuProfilerTrace.h>
+
+/**
+ *
+ */
+
+DECLARE_STATS_GROUP(TEXT("MF Extra Actions"), STATGROUP_MFEA, STATCAT_Advanced);
+
+/* Enable with -trace=cpu,MFEA to get the feature, action and actor of each scope in Unreal Insights */
+UE_TRACE_CHANNEL_EXTERN(MFEAChannel);
+
+/* Named trace event with the feature, action and actor names. The text is only built if the MFEA channel is enabled */
+struct FMFEA_TraceScope
+{
+	FMFEA_TraceScope(const TCHAR* ScopeName, const UObject* Action, const UObject* Actor)
+	{
+#if CPUPROFILERTRACE_ENABLED
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(MFEAChannel))
+		{
+			const FString EventName = FString::Printf(TEXT("%s [%s.%s] %s"), ScopeName, *GetNameSafe(Action ? Action->GetOuter() : nullptr),
+			                                          *GetNameSafe(Action ? Action->GetClass() : nullptr), *GetNameSafe(Actor));
+
+			FCpuProfilerTrace::OutputBeginDynamicEvent(*EventName);
+			bEventStarted = true;
+		}
+#endif
+	}
+
+	~FMFEA_TraceScope()
+	{
+#if CPUPROFILERTRACE_ENABLED
+		if (bEventStarted)
+		{
+			FCpuProfilerTrace::OutputEndEvent();
+		}
+#endif
+	}
+
+	UE_NONCOPYABLE(FMFEA_TraceScope);
+
+private:
+	bool bEventStarted = false;
+};
+
+/* Cycle counter of the STATGROUP_MFEA stat plus a trace event of the MFEA channel. The stat must be declared with DECLARE_CYCLE_STAT */
+#define MFEA_SCOPE_CYCLE_COUNTER(Stat, Action, Actor) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	const FMFEA_TraceScope PREPROCESSOR_JOIN(MFEA_TraceScope_, __LINE__)(TEXT(#Stat), Action, Actor)
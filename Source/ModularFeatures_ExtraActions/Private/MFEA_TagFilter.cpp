@@ -0,0 +1,87 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#include "MFEA_TagFilter.h"
+#include <GameFramework/Actor.h>
+
+namespace MFEA_TagFilter_Internal
+{
+	/* Only accessed by the game thread: filters are compiled on activation and signatures are built during the extension events */
+	static TMap<FName, int32>& GetInternedTags()
+	{
+		static TMap<FName, int32> InternedTags;
+		return InternedTags;
+	}
+
+	static int32 InternTag(const FName& Tag)
+	{
+		check(IsInGameThread());
+
+		TMap<FName, int32>& InternedTags = GetInternedTags();
+		if (const int32* const ExistingIndex = InternedTags.Find(Tag))
+		{
+			return *ExistingIndex;
+		}
+
+		return InternedTags.Add(Tag, InternedTags.Num());
+	}
+
+	static int32 FindTag(const FName& Tag)
+	{
+		const int32* const ExistingIndex = GetInternedTags().Find(Tag);
+		return ExistingIndex ? *ExistingIndex : INDEX_NONE;
+	}
+}
+
+FMFEA_TagSignature FMFEA_TagSignature::MakeFromActor(const AActor* Actor)
+{
+	FMFEA_TagSignature Signature;
+	if (!IsValid(Actor))
+	{
+		return Signature;
+	}
+
+	for (const FName& Tag : Actor->Tags)
+	{
+		if (const int32 TagIndex = MFEA_TagFilter_Internal::FindTag(Tag); TagIndex != INDEX_NONE)
+		{
+			Signature.AddTagIndex(TagIndex);
+		}
+	}
+
+	return Signature;
+}
+
+void FMFEA_TagSignature::AddTagIndex(const int32 TagIndex)
+{
+	const int32 WordIndex = TagIndex / 64;
+	if (WordIndex >= Words.Num())
+	{
+		Words.AddZeroed(WordIndex - Words.Num() + 1);
+	}
+
+	Words[WordIndex] |= uint64(1) << (TagIndex % 64);
+}
+
+void FMFEA_TagFilter::Compile(const TArray<FName>& RequiredTags)
+{
+	Reset();
+
+	for (const FName& Tag : RequiredTags)
+	{
+		if (Tag.IsNone())
+		{
+			bNeverMatches = true;
+			continue;
+		}
+
+		RequiredSignature.AddTagIndex(MFEA_TagFilter_Internal::InternTag(Tag));
+	}
+}
+
+void FMFEA_TagFilter::Reset()
+{
+	RequiredSignature = FMFEA_TagSignature();
+	bNeverMatches = false;
+}
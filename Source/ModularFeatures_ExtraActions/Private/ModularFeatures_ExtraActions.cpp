@@ -3,14 +3,21 @@
 // Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
 
 #include "ModularFeatures_ExtraActions.h"
+#include "MFEA_EventLog.h"
+#include "MFEA_Settings.h"
+#include "Interfaces/MFEA_AbilityInputBinding.h"
 #include <Modules/ModuleManager.h>
 
 void FModularFeatures_ExtraActionsModule::StartupModule()
 {
+	FMFEA_EventLog::Initialize(UMFEA_Settings::Get()->EventLogCapacity);
+	FMFEA_AbilityInputBindingDispatch::Initialize();
 }
 
 void FModularFeatures_ExtraActionsModule::ShutdownModule()
 {
+	FMFEA_AbilityInputBindingDispatch::Shutdown();
+	FMFEA_EventLog::Shutdown();
 }
 
 IMPLEMENT_MODULE(FModularFeatures_ExtraActionsModule, ModularFeatures_ExtraActions);
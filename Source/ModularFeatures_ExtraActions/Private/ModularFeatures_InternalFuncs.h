@@ -22,22 +22,13 @@ namespace ModularFeaturesHelper
 		return Instance;
 	}
 
-	static bool ActorHasAllRequiredTags(const AActor* Actor, const TArray<FName>& RequiredTags)
+	template<typename SoftReferenceType>
+	static void AddSoftReferenceToPreload(TArray<FSoftObjectPath>& OutAssets, const SoftReferenceType& SoftReference)
 	{
-		if (!IsValid(Actor))
+		if (!SoftReference.IsNull())
 		{
-			return false;
-		}
-
-		for (const FName& Tag : RequiredTags)
-		{
-			if (!Actor->ActorHasTag(Tag))
-			{
-				return false;
-			}
+			OutAssets.AddUnique(SoftReference.ToSoftObjectPath());
 		}
-
-		return true;
 	}
 
 	static UAbilitySystemComponent* GetAbilitySystemComponentInActor(AActor* InActor)
@@ -57,7 +48,7 @@ namespace ModularFeaturesHelper
 		return GetPluginSettings()->InputBindingOwner;
 	}
 
-	static IMFEA_AbilityInputBinding* GetAbilityInputBindingInterface(AActor* InActor, const EInputBindingOwnerOverride& InOwner)
+	static UObject* GetAbilityInputBindingOwner(AActor* InActor, const EInputBindingOwnerOverride& InOwner)
 	{
 		if (!IsValid(InActor))
 		{
@@ -66,12 +57,19 @@ namespace ModularFeaturesHelper
 
 		if (APawn* const TargetPawn = Cast<APawn>(InActor))
 		{
+			UObject* InterfaceOwner = nullptr;
 			switch (GetValidatedInputBindingOwner(InOwner))
 			{
-			case EInputBindingOwner::Pawn: return Cast<IMFEA_AbilityInputBinding>(TargetPawn);
-			case EInputBindingOwner::Controller: return Cast<IMFEA_AbilityInputBinding>(TargetPawn->GetController());
+			case EInputBindingOwner::Pawn: InterfaceOwner = TargetPawn;
+				break;
+
+			case EInputBindingOwner::Controller: InterfaceOwner = TargetPawn->GetController();
+				break;
+
 			default: return nullptr;
 			}
+
+			return FMFEA_AbilityInputBindingDispatch::IsInterfaceOwner(InterfaceOwner) ? InterfaceOwner : nullptr;
 		}
 
 		return nullptr;
@@ -104,64 +102,56 @@ namespace ModularFeaturesHelper
 		return nullptr;
 	}
 
-	static UEnum* LoadInputEnum()
+	static FMFEA_AbilityBindingEntry MakeAbilityBindingEntry(UInputAction* InputAction, const FGameplayAbilitySpec& AbilitySpec,
+	                                                         const FGameplayTagContainer& BindingTags = FGameplayTagContainer::EmptyContainer)
 	{
-		if (GetPluginSettings()->InputIDEnumeration.IsNull())
+		FMFEA_AbilityBindingEntry NewEntry;
+		NewEntry.Action = InputAction;
+		NewEntry.InputID = AbilitySpec.InputID;
+
+		// Only fill the data used by the current binding mode to avoid copying the spec and tags of every ability
+		switch (GetPluginSettings()->AbilityBindingMode)
 		{
-			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: bUseInputEnumeration is set to true but Enumeration class is null!"),
-			       *FString(__FUNCTION__));
-			return nullptr;
-		}
+		case (EAbilityBindingMode::AbilitySpec):
+			NewEntry.AbilitySpec = AbilitySpec;
+			break;
 
-		return GetPluginSettings()->InputIDEnumeration.LoadSynchronous();
-	}
+		case (EAbilityBindingMode::AbilityTags):
+			if (IsValid(AbilitySpec.Ability))
+			{
+				NewEntry.AbilityTags = AbilitySpec.Ability->AbilityTags;
+			}
 
-	// Will be removed in the future - but i don't want to break existing projects :)
-	static const bool BindAbilityInputToInterfaceOwnerWithID(const IMFEA_AbilityInputBinding* TargetInterfaceOwner, UInputAction* InputAction,
-	                                                         const int32 InputID)
-	{
-		if (!TargetInterfaceOwner)
-		{
-			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error,
-			       TEXT("%s: Failed to setup input binding on Actor %s due to a invalid interface owner."), *FString(__FUNCTION__),
-			       *TargetInterfaceOwner->_getUObject()->GetName());
+			NewEntry.AbilityTags.AppendTags(BindingTags);
+			break;
 
-			return false;
+		case (EAbilityBindingMode::AbilityClass):
+			if (IsValid(AbilitySpec.Ability))
+			{
+				NewEntry.AbilityClass = AbilitySpec.Ability->GetClass();
+			}
+			break;
+
+		default: break;
 		}
 
-		return true;
+		return NewEntry;
 	}
 
-	static const bool BindAbilityInputToInterfaceOwner(const IMFEA_AbilityInputBinding* TargetInterfaceOwner, UInputAction* InputAction,
-	                                                   const FGameplayAbilitySpec& AbilitySpec)
+	static const bool BindAbilityInputsToInterfaceOwner(UObject* TargetInterfaceOwner, const TArray<FMFEA_AbilityBindingEntry>& Bindings)
 	{
-		if (!BindAbilityInputToInterfaceOwnerWithID(TargetInterfaceOwner, InputAction, AbilitySpec.InputID))
+		if (!IsValid(TargetInterfaceOwner))
 		{
+			UE_LOG(LogGameplayFeaturesExtraActions_Internal, Error, TEXT("%s: Failed to setup input bindings due to a invalid interface owner."),
+			       *FString(__FUNCTION__));
+
 			return false;
 		}
 
-		switch (GetPluginSettings()->AbilityBindingMode)
+		// A single interface call for all bindings if the owner implements a batched interface, otherwise each entry is sent to the SetupAbilityBindingBy functions
+		if (!Bindings.IsEmpty())
 		{
-		case (EAbilityBindingMode::InputID):
-			IMFEA_AbilityInputBinding::Execute_SetupAbilityBindingByInput(TargetInterfaceOwner->_getUObject(), InputAction, AbilitySpec.InputID);
-			break;
-
-		case (EAbilityBindingMode::AbilitySpec):
-			IMFEA_AbilityInputBinding::Execute_SetupAbilityBindingBySpec(TargetInterfaceOwner->_getUObject(), InputAction, AbilitySpec);
-			break;
-
-		case (EAbilityBindingMode::AbilityTags):
-			IMFEA_AbilityInputBinding::Execute_SetupAbilityBindingByTags(TargetInterfaceOwner->_getUObject(), InputAction,
-			                                                             AbilitySpec.Ability->AbilityTags);
-			break;
-
-		case (EAbilityBindingMode::AbilityClass):
-			IMFEA_AbilityInputBinding::Execute_SetupAbilityBindingByClass(TargetInterfaceOwner->_getUObject(), InputAction,
-			                                                              TSubclassOf<UGameplayAbility>(AbilitySpec.Ability->GetClass()));
-			break;
-
-		default:
-			return false;
+			FMFEA_AbilityInputBindingDispatch::SetupAbilityBindings(TargetInterfaceOwner, Bindings);
 		}
 
 		return true;
@@ -176,17 +166,24 @@ namespace ModularFeaturesHelper
 			return;
 		}
 
-		for (TWeakObjectPtr<UInputAction>& InputRef : ActionArr)
+		TArray<UInputAction*> ActionsToRemove;
+		ActionsToRemove.Reserve(ActionArr.Num());
+
+		for (const TWeakObjectPtr<UInputAction>& InputRef : ActionArr)
 		{
 			if (InputRef.IsValid())
 			{
-				IMFEA_AbilityInputBinding::Execute_RemoveAbilityInputBinding(InterfaceOwner, InputRef.Get());
+				ActionsToRemove.Add(InputRef.Get());
 			}
-
-			InputRef.Reset();
 		}
 
 		ActionArr.Empty();
+
+		// A single interface call for all actions if the owner implements a batched interface, otherwise each action is sent to RemoveAbilityInputBinding
+		if (!ActionsToRemove.IsEmpty())
+		{
+			FMFEA_AbilityInputBindingDispatch::RemoveAbilityInputBindings(InterfaceOwner, ActionsToRemove);
+		}
 	}
 
 	static const bool IsUsingInputIDEnumeration()
@@ -194,18 +191,9 @@ namespace ModularFeaturesHelper
 		return GetPluginSettings()->AbilityBindingMode == EAbilityBindingMode::InputID;
 	}
 
-	static const int32 GetInputIDByName(const FName DisplayName, UEnum* Enumeration = nullptr)
+	static const int32 GetInputIDByName(const FName ValueName)
 	{
-		if (!IsUsingInputIDEnumeration())
-		{
-			return -1;
-		}
-
-		if (!Enumeration)
-		{
-			Enumeration = GetPluginSettings()->InputIDEnumeration.LoadSynchronous();
-		}
-
-		return Enumeration->GetValueByName(DisplayName, EGetByNameFlags::CheckAuthoredName);
+		// The settings keep the lookup table of the enumeration, if not using InputID binding mode the value is -1
+		return GetPluginSettings()->GetInputIDByName(ValueName);
 	}
 }
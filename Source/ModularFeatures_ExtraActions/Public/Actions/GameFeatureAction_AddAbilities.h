@@ -7,11 +7,14 @@
 #include <CoreMinimal.h>
 #include <GameplayAbilitySpec.h>
 #include "Actions/GameFeatureAction_WorldActionBase.h"
+#include "MFEA_ExtensionRecordStore.h"
+#include "MFEA_TagFilter.h"
 #include "GameFeatureAction_AddAbilities.generated.h"
 
+class UAbilitySystemComponent;
 class UGameplayAbility;
 class UInputAction;
-struct FComponentRequestHandle;
+struct FMFEA_AbilityBindingEntry;
 
 /**
  *
@@ -63,24 +66,48 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", meta = (DisplayName = "Ability Mapping", ShowOnlyInnerProperties))
 	TArray<FAbilityMapping> Abilities;
 
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+
 protected:
 	virtual void OnGameFeatureActivating(FGameFeatureActivatingContext& Context) override;
 	virtual void OnGameFeatureDeactivating(FGameFeatureDeactivatingContext& Context) override;
 	virtual void AddToWorld(const FWorldContext& WorldContext) override;
+	virtual void GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const override;
+	virtual void OnAssetsPreloaded() override;
+
+#if WITH_EDITOR
+	virtual void ValidateActionData(TArray<FText>& OutErrors) const override;
+#endif
 
 private:
-	void HandleActorExtension(AActor* Owner, FName EventName);
+	virtual void HandleActorExtension(const FMFEA_ExtensionContext& Context) override;
+	virtual void ProcessExtensionWork(const FMFEA_ExtensionContext& Context, EExtensionWorkType WorkType) override;
 	virtual void ResetExtension() override;
-
-	void AddActorAbilities(AActor* TargetActor, const FAbilityMapping& Ability);
-	void RemoveActorAbilities(AActor* TargetActor);
+	virtual int32 GetNumExtendedActors() const override;
 
 	struct FActiveAbilityData
 	{
+		TWeakObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
 		TArray<FGameplayAbilitySpecHandle> SpecHandle;
 		TArray<TWeakObjectPtr<UInputAction>> InputReference;
 	};
 
-	TMap<TWeakObjectPtr<AActor>, FActiveAbilityData> ActiveExtensions;
-	TWeakObjectPtr<UEnum> InputIDEnumeration_Ptr;
+	/* Give all abilities of this action to the actor in a single pass */
+	void ExtendActorAbilities(const FMFEA_ExtensionContext& Context);
+	void AddActorAbilities(const FMFEA_ExtensionContext& Context, TArray<FMFEA_AbilityBindingEntry>& OutBindings);
+	void RemoveActorAbilities(AActor* TargetActor);
+	void RemoveActorAbilities(AActor* TargetActor, FActiveAbilityData& ActiveAbilities);
+
+	TMFEA_ExtensionRecordStore<FActiveAbilityData> ActiveExtensions;
+	FMFEA_TagFilter RequireTagsFilter;
+
+	void CompileInputIDs();
+	bool HasBakedInputIDs() const;
+
+	/* InputID of each element of Abilities, resolved once per activation */
+	TArray<int32> CompiledInputIDs;
+
+	/* InputID of each element of Abilities, resolved when cooking. Only used by cooked builds, so the InputID enumeration isn't loaded at runtime */
+	UPROPERTY()
+	TArray<int32> BakedInputIDs;
 };
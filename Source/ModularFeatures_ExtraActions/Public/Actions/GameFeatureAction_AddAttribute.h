@@ -0,0 +1,87 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "Actions/GameFeatureAction_WorldActionBase.h"
+#include "MFEA_ExtensionRecordStore.h"
+#include "MFEA_TagFilter.h"
+#include "GameFeatureAction_AddAttribute.generated.h"
+
+class UAttributeSet;
+class UDataTable;
+
+/**
+ *
+ */
+UCLASS(MinimalAPI, meta = (DisplayName = "MF Extra Actions: Add Attribute"))
+class UGameFeatureAction_AddAttribute final : public UGameFeatureAction_WorldActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/* Target pawn to which attribute will be given */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", meta = (AllowedClasses = "/Script/Engine.Pawn", OnlyPlaceable = "true"))
+	TSoftClassPtr<APawn> TargetPawnClass;
+
+	/* Tags required on the target to apply this action */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TArray<FName> RequireTags;
+
+	/* AttributeSet class to be added */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TSoftClassPtr<UAttributeSet> Attribute;
+
+	/* Data Table with Attribute Meta Data to be added (can be left unset) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TSoftObjectPtr<UDataTable> InitializationData;
+
+	/* Resolve the rows of the Initialization Data once per activation and write them directly to each new AttributeSet instead of calling InitFromMetaDataTable.
+	 * Only enable it if the AttributeSet class doesn't override InitFromMetaDataTable, its custom initialization would be skipped. Always used by AttributeSet
+	 * classes without a native parent other than UAttributeSet */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	bool bPrecompileInitializationData = false;
+
+protected:
+	virtual void OnGameFeatureActivating(FGameFeatureActivatingContext& Context) override;
+	virtual void OnGameFeatureDeactivating(FGameFeatureDeactivatingContext& Context) override;
+	virtual void AddToWorld(const FWorldContext& WorldContext) override;
+	virtual void GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const override;
+	virtual void OnAssetsPreloaded() override;
+
+#if WITH_EDITOR
+	virtual void ValidateActionData(TArray<FText>& OutErrors) const override;
+#endif
+
+private:
+	virtual void HandleActorExtension(const FMFEA_ExtensionContext& Context) override;
+	virtual void ProcessExtensionWork(const FMFEA_ExtensionContext& Context, EExtensionWorkType WorkType) override;
+	virtual void ResetExtension() override;
+	virtual int32 GetNumExtendedActors() const override;
+
+	void AddAttribute(const FMFEA_ExtensionContext& Context);
+	void RemoveAttribute(AActor* TargetActor);
+	void RemoveAttribute(AActor* TargetActor, UAttributeSet* AttributeToRemove);
+
+	struct FAttributeInitializer
+	{
+		/* Null if the property is a FGameplayAttributeData */
+		FNumericProperty* NumericProperty = nullptr;
+		int32 Offset = 0;
+		float BaseValue = 0.f;
+	};
+
+	void CompileInitializationData();
+	void InitializeAttributeSet(UAttributeSet* AttributeSet) const;
+
+	TMFEA_ExtensionRecordStore<TWeakObjectPtr<UAttributeSet>> ActiveExtensions;
+	FMFEA_TagFilter RequireTagsFilter;
+
+	/* InitializationData rows resolved to the properties of the AttributeSet class once per activation */
+	TArray<FAttributeInitializer> CompiledInitialization;
+
+	/* If false, the AttributeSet is initialized by its InitFromMetaDataTable */
+	bool bUseCompiledInitialization = false;
+};
@@ -7,12 +7,14 @@
 #include <CoreMinimal.h>
 #include <GameplayTagContainer.h>
 #include <GameplayEffectTypes.h>
+#include <GameplayEffect.h>
 #include "Actions/GameFeatureAction_WorldActionBase.h"
+#include "MFEA_ExtensionRecordStore.h"
+#include "MFEA_TagFilter.h"
 #include "GameFeatureAction_AddEffects.generated.h"
 
 class UGameplayEffect;
-struct FActiveGameplayEffectHandle;
-struct FComponentRequestHandle;
+class UAbilitySystemComponent;
 
 /**
  *
@@ -60,13 +62,49 @@ protected:
 	virtual void OnGameFeatureActivating(FGameFeatureActivatingContext& Context) override;
 	virtual void OnGameFeatureDeactivating(FGameFeatureDeactivatingContext& Context) override;
 	virtual void AddToWorld(const FWorldContext& WorldContext) override;
+	virtual void GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const override;
+	virtual void OnAssetsPreloaded() override;
+
+#if WITH_EDITOR
+	virtual void ValidateActionData(TArray<FText>& OutErrors) const override;
+#endif
 
 private:
-	void HandleActorExtension(AActor* Owner, FName EventName);
+	virtual void HandleActorExtension(const FMFEA_ExtensionContext& Context) override;
+	virtual void ProcessExtensionWork(const FMFEA_ExtensionContext& Context, EExtensionWorkType WorkType) override;
 	virtual void ResetExtension() override;
+	virtual int32 GetNumExtendedActors() const override;
+
+	struct FCompiledEffect
+	{
+		/* Index inside SpecTemplates or INDEX_NONE if the spec must be created for each actor */
+		int32 TemplateIndex = INDEX_NONE;
+		TArray<TPair<FGameplayTag, float>> SetByCallerMagnitudes;
+	};
 
-	void AddEffects(AActor* TargetActor, const FEffectStackedData& Effect);
+	void CompileEffects();
+
+	void AddActorEffects(const FMFEA_ExtensionContext& Context);
+	void AddEffects(const FMFEA_ExtensionContext& Context, const FEffectStackedData& Effect, const FCompiledEffect& CompiledEffect);
 	void RemoveEffects(AActor* TargetActor);
 
-	TMap<TWeakObjectPtr<AActor>, TArray<FActiveGameplayEffectHandle>> ActiveExtensions;
+	struct FEffectsExtension
+	{
+		TWeakObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
+
+		/* Effects applied to this actor only - The component can be shared with other actors, e.g. if it's owned by the player state */
+		TArray<FActiveGameplayEffectHandle> EffectHandles;
+	};
+
+	void RemoveAllEffects(AActor* TargetActor, const FEffectsExtension& Extension);
+
+	/* Ability system component and effects of each actor - On reset, the effects of each actor are removed with a single query matching its handles */
+	TMFEA_ExtensionRecordStore<FEffectsExtension> ActiveExtensions;
+	FMFEA_TagFilter RequireTagsFilter;
+
+	/* Specs without context, shared by the entries with the same effect class and level */
+	TArray<FGameplayEffectSpec> SpecTemplates;
+
+	/* One entry for each element of Effects */
+	TArray<FCompiledEffect> CompiledEffects;
 };
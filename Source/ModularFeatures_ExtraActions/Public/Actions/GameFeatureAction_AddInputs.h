@@ -8,13 +8,15 @@
 #include <InputTriggers.h>
 #include <EnhancedInputComponent.h>
 #include <GameplayAbilitySpec.h>
+#include <UObject/ObjectKey.h>
 #include "Actions/GameFeatureAction_WorldActionBase.h"
+#include "MFEA_ExtensionRecordStore.h"
+#include "MFEA_TagFilter.h"
 #include "GameFeatureAction_AddInputs.generated.h"
 
 class UGameplayAbility;
 class UInputMappingContext;
 class UEnhancedInputLocalPlayerSubsystem;
-struct FComponentRequestHandle;
 
 /**
  *
@@ -49,7 +51,7 @@ struct FAbilityInputBindingData
 		meta = (DisplayName = "InputID Value Name", EditCondition = "bSetupAbilityInput"))
 	FName InputIDValueName = NAME_None;
 
-	/* Bind this input to an ability activation using Ability Tags container - If binding mode is set to Ability Tags */
+	/* Bind this input to an ability activation using Ability Tags container - If binding mode is set to Ability Tags. Passed with the ability tags to the binding, the ability class isn't modified */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", meta = (EditCondition = "bSetupAbilityInput"))
 	FGameplayTagContainer AbilityTags = FGameplayTagContainer::EmptyContainer;
 
@@ -113,30 +115,84 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", meta = (DisplayName = "Actions Bindings", ShowOnlyInnerProperties))
 	TArray<FInputMappingStack> ActionsBindings;
 
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+
 protected:
 	virtual void OnGameFeatureActivating(FGameFeatureActivatingContext& Context) override;
 	virtual void OnGameFeatureDeactivating(FGameFeatureDeactivatingContext& Context) override;
 	virtual void AddToWorld(const FWorldContext& WorldContext) override;
+	virtual void GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const override;
+	virtual void OnAssetsPreloaded() override;
+
+#if WITH_EDITOR
+	virtual void ValidateActionData(TArray<FText>& OutErrors) const override;
+#endif
 
 private:
-	void HandleActorExtension(AActor* Owner, FName EventName);
+	virtual void HandleActorExtension(const FMFEA_ExtensionContext& Context) override;
+	virtual void ProcessExtensionWork(const FMFEA_ExtensionContext& Context, EExtensionWorkType WorkType) override;
 	virtual void ResetExtension() override;
+	virtual int32 GetNumExtendedActors() const override;
+
+	struct FInputBindingData
+	{
+		TArray<FInputBindingHandle> ActionBinding;
+		TWeakObjectPtr<UInputMappingContext> Mapping;
+
+		/* Actions bound to abilities of this actor, removed from its interface owner together with the other bindings */
+		TArray<TWeakObjectPtr<UInputAction>> AbilityActions;
+	};
 
-	void AddActorInputs(AActor* TargetActor);
+	void AddActorInputs(const FMFEA_ExtensionContext& Context);
 	void RemoveActorInputs(AActor* TargetActor);
+	void RemoveActorInputs(APawn* TargetPawn, FInputBindingData& ActiveInputData);
 
-	void SetupActionBindings(AActor* TargetActor, UObject* FunctionOwner, UEnhancedInputComponent* InputComponent);
+	void SetupActionBindings(const FMFEA_ExtensionContext& Context, UObject* FunctionOwner, UEnhancedInputComponent* InputComponent);
 
-	FGameplayAbilitySpec GetAbilitySpecInformationFromBindingData(AActor* TargetActor, const FAbilityInputBindingData& AbilityBindingData,
-	                                                              UEnum* InputIDEnum = nullptr);
 	UEnhancedInputLocalPlayerSubsystem* GetEnhancedInputComponentFromPawn(APawn* TargetPawn);
 
-	struct FInputBindingData
+	struct FCompiledFunctionBinding
 	{
-		TArray<FInputBindingHandle> ActionBinding;
-		TWeakObjectPtr<UInputMappingContext> Mapping;
+		FName FunctionName;
+		ETriggerEvent Trigger;
 	};
 
-	TMap<TWeakObjectPtr<AActor>, FInputBindingData> ActiveExtensions;
-	TArray<TWeakObjectPtr<UInputAction>> AbilityActions;
+	struct FCompiledActionBinding
+	{
+		UInputAction* InputAction = nullptr;
+
+		/* Range of this action inside CompiledFunctionBindings */
+		int32 FirstFunctionBinding = 0;
+		int32 NumFunctionBindings = 0;
+
+		bool bSetupAbilityInput = false;
+		bool bFindAbilitySpec = false;
+
+		/* Spec passed to the ability binding, with the resolved InputID and ability class */
+		FGameplayAbilitySpec AbilitySpec;
+
+		/* Tags of the binding data, added to the tags of the ability when the binding mode is Ability Tags */
+		FGameplayTagContainer AbilityTags;
+	};
+
+	void CompileActionsBindings();
+	bool HasBakedInputIDs() const;
+	const FGameplayAbilitySpec& GetAbilitySpecFromCompiledBinding(const FMFEA_ExtensionContext& Context, const FCompiledActionBinding& Binding) const;
+
+	/* Resolve the functions of CompiledFunctionBindings in the given class, once per class. Functions that can't be bound are reported once and set to null */
+	const TArray<UFunction*>& ResolveFunctionBindings(const UClass* FunctionOwnerClass);
+
+	TMFEA_ExtensionRecordStore<FInputBindingData> ActiveExtensions;
+	FMFEA_TagFilter RequireTagsFilter;
+
+	/* ActionsBindings flattened once per activation */
+	TArray<FCompiledActionBinding> CompiledBindings;
+	TArray<FCompiledFunctionBinding> CompiledFunctionBindings;
+
+	/* Functions of each function owner class, sharing the index of CompiledFunctionBindings */
+	TMap<FObjectKey, TArray<UFunction*>> ResolvedFunctionsByClass;
+
+	/* InputID of each element of ActionsBindings, resolved when cooking. Only used by cooked builds, so the InputID enumeration isn't loaded at runtime */
+	UPROPERTY()
+	TArray<int32> BakedInputIDs;
 };
@@ -0,0 +1,172 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Containers/Ticker.h>
+#include "Actions/GameFeatureAction_WorldActionBase.h"
+#include "GameFeatureAction_SpawnActors.generated.h"
+
+class UGameFeatureAction_SpawnActors;
+struct FComponentRequestHandle;
+struct FStreamableHandle;
+
+/* Action, processed actors and total actors of the current spawn or destroy request */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FSpawnActorsProgressDelegate, const UGameFeatureAction_SpawnActors*, int32, int32);
+/**
+ *
+ */
+USTRUCT(BlueprintType, Category = "MF Extra Actions | Modular Structs")
+struct FActorSpawnSettings
+{
+	GENERATED_BODY()
+
+	/* Actor class to be spawned */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", meta = (OnlyPlaceable = "true"))
+	TSoftClassPtr<AActor> ActorClass;
+
+	/* Transform settings to be added to spawned actor */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FTransform SpawnTransform;
+};
+
+/**
+ *
+ */
+UCLASS(MinimalAPI, meta = (DisplayName = "MF Extra Actions: Spawn Actors"))
+class UGameFeatureAction_SpawnActors final : public UGameFeatureAction
+{
+	GENERATED_BODY()
+
+public:
+	/* Target levels to which actors will be spawned */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TArray<TSoftObjectPtr<UWorld>> TargetLevels;
+
+	/* Stacked spawn settings */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TArray<FActorSpawnSettings> SpawnSettings;
+
+	/* Maximum number of actors spawned per frame - Set to 0 to not limit the number of spawns */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Performance", meta = (ClampMin = "0"))
+	int32 MaxSpawnsPerFrame = 0;
+
+	/* Maximum number of actors destroyed per frame - Set to 0 to not limit the number of destructions */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Performance", meta = (ClampMin = "0"))
+	int32 MaxDestroysPerFrame = 0;
+
+	/* Maximum time in milliseconds spent spawning or destroying actors per frame - Set to 0 to not limit the time */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Performance", meta = (DisplayName = "Frame Budget (ms)", ClampMin = "0", Units = "Milliseconds"))
+	float FrameBudget = 0.f;
+
+	/* Hide and keep the spawned actors in a pool when the feature is deactivated, to reuse them in the next activation instead of spawning new actors */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pooling")
+	bool bPoolActors = false;
+
+	/* Maximum number of actors kept in the pool for each actor class - Set to 0 to not limit the pool size */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pooling", meta = (EditCondition = "bPoolActors", ClampMin = "0"))
+	int32 MaxPooledActorsPerClass = 0;
+
+	/* Time in seconds that an unused actor is kept in the pool before being destroyed - Set to 0 to keep the actors until their world is destroyed */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pooling", meta = (EditCondition = "bPoolActors", ClampMin = "0", Units = "Seconds"))
+	float PooledActorLifetime = 0.f;
+
+	/* Called each frame while the actors are being spawned across frames */
+	FSpawnActorsProgressDelegate OnSpawnProgress;
+
+	/* Called each frame while the actors are being destroyed across frames */
+	FSpawnActorsProgressDelegate OnDestroyProgress;
+
+	virtual void PostLoad() override;
+
+	/* Destroy all actors kept in the pool */
+	void EmptyActorPool();
+
+protected:
+	virtual void OnGameFeatureActivating(FGameFeatureActivatingContext& Context) override;
+	virtual void OnGameFeatureDeactivating(FGameFeatureDeactivatingContext& Context) override;
+	virtual void OnGameFeatureUnregistering() override;
+
+	void OnWorldInitialized(UWorld* World, const UWorld::InitializationValues InitializationValues);
+
+private:
+	void HandleClassesLoaded();
+	void ReleaseClassesHandle();
+
+	void AddToWorld(UWorld* World);
+	void SpawnActors(UWorld* WorldReference);
+	void DestroyActors();
+
+	bool IsSpawnTimeSliced() const;
+	bool IsDestroyTimeSliced() const;
+
+	bool ProcessPendingActors(float DeltaTime);
+	bool ProcessPendingSpawns(double StartTime);
+	bool ProcessPendingDestroys(double StartTime);
+	bool HasFrameBudget(double StartTime) const;
+	void StartPendingActorsTicker();
+
+	bool ParkActor(AActor* Actor);
+	AActor* ReusePooledActor(UWorld* World, const UClass* ActorClass, const FTransform& SpawnTransform);
+	bool TrimActorPool(float DeltaTime);
+
+	void ResetExtension();
+
+	/* Previous single target level, moved into TargetLevels on load */
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Use TargetLevels instead."))
+	TSoftObjectPtr<UWorld> TargetLevel_DEPRECATED;
+
+	/* Package names of the target levels, used to match the worlds without loading the level assets */
+	TSet<FName> TargetLevelNames;
+
+	/* Keeps the actor classes resident while the feature is active, so the spawns will not touch the disk */
+	TSharedPtr<FStreamableHandle> ClassesHandle;
+	FGameFeatureStateChangeContext ActivationContext;
+
+	TArray<TWeakObjectPtr<AActor>> SpawnedActors;
+	FDelegateHandle WorldInitializedHandle;
+
+	struct FPendingSpawn
+	{
+		TWeakObjectPtr<UWorld> World;
+		int32 SettingsIndex = INDEX_NONE;
+	};
+
+	struct FDeferredSpawn
+	{
+		TWeakObjectPtr<AActor> Actor;
+		int32 SettingsIndex = INDEX_NONE;
+	};
+
+	/* Spawns waiting for the frame budget */
+	TArray<FPendingSpawn> PendingSpawns;
+
+	/* Actors spawned deferred in the last frame, their construction will be finished in the next frame */
+	TArray<FDeferredSpawn> DeferredSpawns;
+
+	/* Actors waiting for the frame budget to be destroyed */
+	TArray<TWeakObjectPtr<AActor>> PendingDestroys;
+
+	int32 SpawnTotal = 0;
+	int32 DestroyTotal = 0;
+	int32 DestroyedNum = 0;
+
+	FTSTicker::FDelegateHandle PendingActorsTickerHandle;
+
+	struct FPooledActor
+	{
+		TWeakObjectPtr<AActor> Actor;
+		double ParkedTime = 0.0;
+
+		/* State of the actor before being parked, restored when it is reused */
+		bool bWasHidden = false;
+		bool bHadCollision = true;
+		bool bWasTickEnabled = true;
+	};
+
+	/* Parked actors by world and actor class */
+	TMap<TPair<FObjectKey, FObjectKey>, TArray<FPooledActor>> ActorPool;
+	FTSTicker::FDelegateHandle PoolTrimTickerHandle;
+};
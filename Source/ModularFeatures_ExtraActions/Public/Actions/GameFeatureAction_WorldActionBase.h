@@ -0,0 +1,132 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <GameFeatureAction.h>
+#include <GameFeaturesSubsystem.h>
+#include <Components/GameFrameworkComponentManager.h>
+#include <UObject/ObjectKey.h>
+#include <Runtime/Launch/Resources/Version.h>
+#include "MFEA_ExtensionSubsystem.h"
+#include "GameFeatureAction_WorldActionBase.generated.h"
+
+class UGameInstance;
+class FDataValidationContext;
+struct FWorldContext;
+struct FStreamableHandle;
+
+UENUM(BlueprintType, Category = "MF Extra Actions | Enums")
+enum class EInputBindingOwnerOverride : uint8
+{
+	Default,
+	Pawn,
+	Controller
+};
+
+/**
+ *
+ */
+UCLASS(MinimalAPI, Abstract)
+class UGameFeatureAction_WorldActionBase : public UGameFeatureAction
+{
+	GENERATED_BODY()
+
+	friend class UMFEA_ExtensionSubsystem;
+
+public:
+	/* Number of actor extensions waiting for the frame budget */
+	int32 GetPendingExtensionWorkNum() const;
+
+	/* Number of actors currently extended by this action */
+	virtual int32 GetNumExtendedActors() const
+	{
+		return 0;
+	}
+
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+
+#if WITH_EDITOR
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#else
+	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+#endif
+#endif
+
+protected:
+	virtual void OnGameFeatureActivating(FGameFeatureActivatingContext& Context) override;
+	virtual void OnGameFeatureDeactivating(FGameFeatureDeactivatingContext& Context) override;
+
+	virtual void AddToWorld(const FWorldContext& WorldContext)
+	{
+	}
+
+	/* Register this action to the extension events of the receiver class, shared with the other actions targeting the same class */
+	void AddExtensionHandler(const FWorldContext& WorldContext, const TSoftClassPtr<AActor>& ReceiverClass);
+
+	UMFEA_ExtensionSubsystem* GetExtensionSubsystem(const FWorldContext& WorldContext) const;
+	TArray<FMFEA_ExtensionRequestHandlePtr> ActiveRequests;
+
+	/* Called by the extension subsystem with the data resolved for the actor */
+	virtual void HandleActorExtension(const FMFEA_ExtensionContext& Context)
+	{
+	}
+
+	virtual void ResetExtension();
+
+	/* Collect the soft references used by this action. They will be streamed in before any actor is extended */
+	virtual void GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const
+	{
+	}
+
+	/* Called when all preloaded assets are resident, right before the action is added to the worlds */
+	virtual void OnAssetsPreloaded()
+	{
+	}
+
+#if WITH_EDITOR
+	/* Collect the configuration errors of this action. Checked by the data validation and when cooking, instead of being logged for each actor at runtime */
+	virtual void ValidateActionData(TArray<FText>& OutErrors) const
+	{
+	}
+
+	static void ValidateRequiredTags(const TArray<FName>& RequiredTags, TArray<FText>& OutErrors);
+#endif
+
+	enum class EExtensionWorkType : uint8
+	{
+		Add,
+		Remove
+	};
+
+	/* Additions are queued in the extension subsystem if the frame budget is set. Removals are processed right away and cancel pending additions of the actor */
+	void QueueExtensionWork(const FMFEA_ExtensionContext& Context, EExtensionWorkType WorkType);
+
+	/* Perform the addition or removal of the extension to the given actor */
+	virtual void ProcessExtensionWork(const FMFEA_ExtensionContext& Context, EExtensionWorkType WorkType)
+	{
+	}
+
+private:
+	void HandleAssetsPreloaded();
+	void ReleasePreloadHandle();
+
+	/* Called by the extension subsystem when the queued addition is processed */
+	void ProcessQueuedExtensionWork(const FMFEA_ExtensionContext& Context, uint32 Serial);
+	void ResetExtensionWork();
+
+	/* Serial of the valid pending addition of each actor. A queued addition whose serial doesn't match was cancelled */
+	TMap<FObjectKey, uint32> PendingAdditions;
+
+	uint32 ExtensionWorkSerial = 0;
+
+	void HandleGameInstanceStart(UGameInstance* GameInstance, FGameFeatureStateChangeContext ChangeContext);
+	FDelegateHandle GameInstanceStartHandle;
+
+	/* Keeps the preloaded assets resident while the feature is active */
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+	FGameFeatureStateChangeContext ActivationContext;
+};
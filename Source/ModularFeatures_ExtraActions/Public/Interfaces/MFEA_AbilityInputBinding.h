@@ -0,0 +1,138 @@
+﻿// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <UObject/Interface.h>
+#include <GameplayAbilitySpec.h>
+#include <GameplayTagContainer.h>
+#include "MFEA_AbilityInputBinding.generated.h"
+
+/**
+ *
+ */
+class UInputAction;
+
+/* Ability binding passed to IMFEA_BatchedAbilityInputBinding: Use the field associated to the Ability Binding Mode of the plugin settings */
+USTRUCT(BlueprintType, Category = "MF Extra Actions | Modular Structs")
+struct FMFEA_AbilityBindingEntry
+{
+	GENERATED_BODY()
+
+	/* Enhanced Input Action to bind */
+	UPROPERTY(BlueprintReadOnly, Category = "Settings")
+	UInputAction* Action = nullptr;
+
+	/* Used if the Ability Binding Mode is InputID */
+	UPROPERTY(BlueprintReadOnly, Category = "Settings", meta = (DisplayName = "InputID"))
+	int32 InputID = INDEX_NONE;
+
+	/* Used if the Ability Binding Mode is AbilitySpec */
+	UPROPERTY(BlueprintReadOnly, Category = "Settings")
+	FGameplayAbilitySpec AbilitySpec;
+
+	/* Used if the Ability Binding Mode is AbilityTags */
+	UPROPERTY(BlueprintReadOnly, Category = "Settings")
+	FGameplayTagContainer AbilityTags;
+
+	/* Used if the Ability Binding Mode is AbilityClass */
+	UPROPERTY(BlueprintReadOnly, Category = "Settings")
+	TSubclassOf<UGameplayAbility> AbilityClass;
+};
+
+/* Your pawn or controller need this inferface to accept ability input bindings */
+UINTERFACE(MinimalAPI, Blueprintable, Category = "MF Extra Actions | Interfaces", Meta = (DisplayName = "MF Extra Actions: Ability Input Binding"))
+class UMFEA_AbilityInputBinding : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/* Your pawn or controller need this inferface to accept ability input bindings */
+class MODULARFEATURES_EXTRAACTIONS_API IMFEA_AbilityInputBinding
+{
+	GENERATED_BODY()
+
+public:
+	/* Setup ability bind using input id - AbilityLocalInputPressed(InputID)*/
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "MF Extra Actions | Modular Interfaces")
+	void SetupAbilityBindingByInput(UInputAction* Action, const int32 InputID);
+
+	/* Setup ability bind using the ability spec - AbilitySpecInputPressed(AbilitySpec) */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "MF Extra Actions | Modular Interfaces")
+	void SetupAbilityBindingBySpec(UInputAction* Action, const FGameplayAbilitySpec& AbilitySpec);
+
+	/* Setup ability bind using the ability tags container - TryActivateAbilitiesByTag(AbilityTags) */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "MF Extra Actions | Modular Interfaces")
+	void SetupAbilityBindingByTags(UInputAction* Action, const FGameplayTagContainer& AbilityTags);
+
+	/* Setup ability bind using the ability tags container - TryActivateAbilityByClass(AbilityClass) */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "MF Extra Actions | Modular Interfaces")
+	void SetupAbilityBindingByClass(UInputAction* Action, TSubclassOf<UGameplayAbility> AbilityClass);
+
+	/* This function is needed for removing ability input binding inside your controller or pawn */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "MF Extra Actions | Modular Interfaces")
+	void RemoveAbilityInputBinding(const UInputAction* Action);
+};
+
+/* Optional interface to receive all ability bindings of the pawn or controller in a single call - Without it, the functions of IMFEA_AbilityInputBinding are called for each binding */
+UINTERFACE(MinimalAPI, Blueprintable, Category = "MF Extra Actions | Interfaces", Meta = (DisplayName = "MF Extra Actions: Batched Ability Input Binding"))
+class UMFEA_BatchedAbilityInputBinding : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/* Optional interface to receive all ability bindings of the pawn or controller in a single call - Without it, the functions of IMFEA_AbilityInputBinding are called for each binding */
+class MODULARFEATURES_EXTRAACTIONS_API IMFEA_BatchedAbilityInputBinding
+{
+	GENERATED_BODY()
+
+public:
+	/* Setup all ability bindings of the pawn in a single call - Use the entry field associated to the Ability Binding Mode of the plugin settings */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "MF Extra Actions | Modular Interfaces")
+	void SetupAbilityBindings(const TArray<FMFEA_AbilityBindingEntry>& Bindings);
+
+	/* Remove all ability input bindings of the pawn in a single call */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "MF Extra Actions | Modular Interfaces")
+	void RemoveAbilityInputBindings(const TArray<UInputAction*>& Actions);
+};
+
+/* C++ only variant of the batched ability input binding interface, called directly without reflection - Takes priority over the other interfaces */
+UINTERFACE(MinimalAPI, Category = "MF Extra Actions | Interfaces",
+	Meta = (CannotImplementInterfaceInBlueprint, DisplayName = "MF Extra Actions: Native Ability Input Binding"))
+class UMFEA_NativeAbilityInputBinding : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/* C++ only variant of the batched ability input binding interface, called directly without reflection - Takes priority over the other interfaces */
+class MODULARFEATURES_EXTRAACTIONS_API IMFEA_NativeAbilityInputBinding
+{
+	GENERATED_BODY()
+
+public:
+	/* Setup all ability bindings of the pawn - Use the entry field associated to the Ability Binding Mode of the plugin settings */
+	virtual void SetupAbilityBindings(const TArray<FMFEA_AbilityBindingEntry>& Bindings) = 0;
+
+	/* Remove all ability input bindings of the pawn */
+	virtual void RemoveAbilityInputBindings(const TArray<UInputAction*>& Actions) = 0;
+};
+
+/* Calls the ability input binding functions on the interface owner: Native C++ implementations are called directly unless the class overrides the function in Blueprint.
+ * The batched functions are only called if the owner implements one of the batched interfaces, otherwise each binding is sent to IMFEA_AbilityInputBinding */
+struct MODULARFEATURES_EXTRAACTIONS_API FMFEA_AbilityInputBindingDispatch
+{
+	/* Bind the cleanup of the classes cache to the Blueprint reinstancing - Called by the module */
+	static void Initialize();
+	static void Shutdown();
+
+	/* Check if the object implements one of the ability input binding interfaces, in C++ or in Blueprint */
+	static bool IsInterfaceOwner(const UObject* InterfaceOwner);
+
+	static void SetupAbilityBindings(UObject* InterfaceOwner, const TArray<FMFEA_AbilityBindingEntry>& Bindings);
+	static void SetupAbilityBinding(UObject* InterfaceOwner, const FMFEA_AbilityBindingEntry& Binding);
+
+	static void RemoveAbilityInputBindings(UObject* InterfaceOwner, const TArray<UInputAction*>& Actions);
+	static void RemoveAbilityInputBinding(UObject* InterfaceOwner, UInputAction* Action);
+};
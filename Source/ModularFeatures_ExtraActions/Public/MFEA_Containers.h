@@ -0,0 +1,22 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Runtime/Launch/Resources/Version.h>
+
+/**
+ *
+ */
+
+namespace MFEA_Containers
+{
+	/* Passed to the removals of the containers that are refilled right away, so their memory isn't released. The bool overloads are deprecated since 5.4 */
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+	inline constexpr EAllowShrinking NoShrinking = EAllowShrinking::No;
+#else
+	inline constexpr bool NoShrinking = false;
+#endif
+}
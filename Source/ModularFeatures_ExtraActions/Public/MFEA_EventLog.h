@@ -0,0 +1,64 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <UObject/ObjectKey.h>
+
+/**
+ *
+ */
+
+enum class EMFEA_EventAction : uint8
+{
+	Abilities,
+	Attribute,
+	Effects,
+	Inputs,
+	SpawnActors
+};
+
+enum class EMFEA_EventKind : uint8
+{
+	Add,
+	Remove,
+	Bind,
+	Spawn,
+	Destroy,
+	Park,
+	Reuse
+};
+
+enum class EMFEA_EventResult : uint8
+{
+	Success,
+	Failed
+};
+
+/* Binary event recorded by the actions: no string is built when recording */
+struct FMFEA_Event
+{
+	uint64 Cycles = 0;
+	FObjectKey Actor;
+	FName Asset;
+	EMFEA_EventAction Action = EMFEA_EventAction::Abilities;
+	EMFEA_EventKind Kind = EMFEA_EventKind::Add;
+	EMFEA_EventResult Result = EMFEA_EventResult::Success;
+};
+
+/* Always-on fixed-size ring buffer of the last events, written without locks and dumped to a file on demand or when the engine crashes */
+class MODULARFEATURES_EXTRAACTIONS_API FMFEA_EventLog
+{
+public:
+	/* Allocate the buffer, the capacity is rounded up to a power of two - A capacity of 0 disables the recording */
+	static void Initialize(int32 Capacity);
+	static void Shutdown();
+
+	static void Record(EMFEA_EventAction Action, EMFEA_EventKind Kind, const UObject* Actor, const UObject* Asset,
+	                   EMFEA_EventResult Result = EMFEA_EventResult::Success);
+
+	/* Write the recorded events from the oldest to the newest. Object names are only resolved if requested, which is not safe while crashing */
+	static bool Dump(const FString& FilePath, bool bResolveObjects);
+};
@@ -0,0 +1,174 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <GameFramework/Actor.h>
+#include <UObject/ObjectKey.h>
+#include "MFEA_Containers.h"
+
+/**
+ *
+ */
+
+/* Stable reference to a record: remains valid while the record exists, even if other records are moved inside the store */
+struct FMFEA_ExtensionHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsValid() const
+	{
+		return Index != INDEX_NONE;
+	}
+
+	bool operator==(const FMFEA_ExtensionHandle& Other) const
+	{
+		return Index == Other.Index && Generation == Other.Generation;
+	}
+};
+
+/* Dense storage of the per-actor data of an action: records are kept in a contiguous array and indexed by the actor key */
+template <typename RecordType>
+class TMFEA_ExtensionRecordStore
+{
+public:
+	int32 Num() const
+	{
+		return Records.Num();
+	}
+
+	bool IsEmpty() const
+	{
+		return Records.IsEmpty();
+	}
+
+	bool Contains(const AActor* Actor) const
+	{
+		return ActorIndex.Contains(FObjectKey(Actor));
+	}
+
+	FMFEA_ExtensionHandle GetHandle(const AActor* Actor) const
+	{
+		const FMFEA_ExtensionHandle* const Handle = ActorIndex.Find(FObjectKey(Actor));
+		return Handle ? *Handle : FMFEA_ExtensionHandle();
+	}
+
+	RecordType* Find(const AActor* Actor)
+	{
+		return Find(GetHandle(Actor));
+	}
+
+	RecordType* Find(const FMFEA_ExtensionHandle& Handle)
+	{
+		if (!Handle.IsValid() || !Slots.IsValidIndex(Handle.Index) || Slots[Handle.Index].Generation != Handle.Generation)
+		{
+			return nullptr;
+		}
+
+		return &Records[Slots[Handle.Index].DenseIndex];
+	}
+
+	RecordType& FindOrAdd(AActor* Actor)
+	{
+		if (RecordType* const ExistingRecord = Find(Actor))
+		{
+			return *ExistingRecord;
+		}
+
+		// Reuse a released slot to keep the slots array compact
+		const int32 SlotIndex = FreeSlots.IsEmpty() ? Slots.AddDefaulted() : FreeSlots.Pop(MFEA_Containers::NoShrinking);
+		FSlot& Slot = Slots[SlotIndex];
+		Slot.DenseIndex = Records.Num();
+
+		DenseToSlot.Add(SlotIndex);
+		Owners.Add(Actor);
+		ActorIndex.Add(FObjectKey(Actor), {SlotIndex, Slot.Generation});
+
+		return Records.AddDefaulted_GetRef();
+	}
+
+	/* Remove the record of the actor by moving the last record into its place */
+	bool Remove(const AActor* Actor)
+	{
+		FMFEA_ExtensionHandle Handle;
+		if (!ActorIndex.RemoveAndCopyValue(FObjectKey(Actor), Handle))
+		{
+			return false;
+		}
+
+		FSlot& Slot = Slots[Handle.Index];
+		const int32 DenseIndex = Slot.DenseIndex;
+		const int32 LastIndex = Records.Num() - 1;
+
+		if (DenseIndex != LastIndex)
+		{
+			Slots[DenseToSlot[LastIndex]].DenseIndex = DenseIndex;
+		}
+
+		Records.RemoveAtSwap(DenseIndex, 1, MFEA_Containers::NoShrinking);
+		Owners.RemoveAtSwap(DenseIndex, 1, MFEA_Containers::NoShrinking);
+		DenseToSlot.RemoveAtSwap(DenseIndex, 1, MFEA_Containers::NoShrinking);
+
+		// Invalidate all handles to the removed record
+		Slot.DenseIndex = INDEX_NONE;
+		++Slot.Generation;
+		FreeSlots.Add(Handle.Index);
+
+		return true;
+	}
+
+	/* Call the function for each record as (AActor* Owner, RecordType& Record). Owner is null if the actor was already destroyed */
+	template <typename FunctionType>
+	void ForEach(FunctionType&& Function)
+	{
+		for (int32 Index = 0; Index < Records.Num(); ++Index)
+		{
+			Function(Owners[Index].Get(), Records[Index]);
+		}
+	}
+
+	/* Call the teardown function for each record in a single pass and release all records - The function must not add or remove records */
+	template <typename FunctionType>
+	void Reset(FunctionType&& Teardown)
+	{
+		ForEach(Forward<FunctionType>(Teardown));
+		Reset();
+	}
+
+	void Reset()
+	{
+		// Keep the slots to invalidate the existing handles instead of reusing their generations
+		for (const int32 SlotIndex : DenseToSlot)
+		{
+			Slots[SlotIndex].DenseIndex = INDEX_NONE;
+			++Slots[SlotIndex].Generation;
+			FreeSlots.Add(SlotIndex);
+		}
+
+		Records.Reset();
+		Owners.Reset();
+		DenseToSlot.Reset();
+		ActorIndex.Reset();
+	}
+
+private:
+	struct FSlot
+	{
+		int32 DenseIndex = INDEX_NONE;
+		uint32 Generation = 0;
+	};
+
+	/* Dense arrays, sharing the same index */
+	TArray<RecordType> Records;
+	TArray<TWeakObjectPtr<AActor>> Owners;
+	TArray<int32> DenseToSlot;
+
+	/* Sparse slots referenced by the handles */
+	TArray<FSlot> Slots;
+	TArray<int32> FreeSlots;
+
+	TMap<FObjectKey, FMFEA_ExtensionHandle> ActorIndex;
+};
@@ -0,0 +1,219 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Subsystems/GameInstanceSubsystem.h>
+#include <Components/GameFrameworkComponentManager.h>
+#include <Containers/Ticker.h>
+#include <UObject/ObjectKey.h>
+#include "MFEA_TagFilter.h"
+#include "MFEA_ExtensionSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UEnhancedInputLocalPlayerSubsystem;
+class UInputMappingContext;
+class UGameFeatureAction_WorldActionBase;
+class UMFEA_ExtensionSubsystem;
+
+/**
+ *
+ */
+
+/* Changes made to the ability system component of an actor by all actions during a single extension event, committed together in a fixed order */
+class FMFEA_AbilitySystemTransaction
+{
+public:
+	/* Commit order: attribute sets exist before the effects that modify them are applied, and abilities are given before the inputs bound to their specs */
+	enum class EPhase : uint8
+	{
+		Attributes,
+		Effects,
+		Abilities,
+		Inputs,
+		Num
+	};
+
+	/* Record the change to be performed when the transaction is committed, or perform it right away if the transaction was already committed */
+	void Execute(EPhase Phase, TFunction<void()>&& Change);
+	void Commit();
+
+private:
+	TArray<TFunction<void()>> Changes[static_cast<uint8>(EPhase::Num)];
+	bool bCommitted = false;
+};
+
+/* Per-actor data resolved once for each extension event and shared by all actions registered to the actor class */
+struct FMFEA_ExtensionContext
+{
+	TWeakObjectPtr<AActor> Actor;
+
+	/* Only resolved for addition events */
+	TWeakObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
+	FMFEA_TagSignature ActorTags;
+
+	FName EventName = NAME_None;
+	bool bHasAuthority = false;
+
+	/* Subsystem that dispatched the event, which also queues the additions waiting for the frame budget */
+	TWeakObjectPtr<UMFEA_ExtensionSubsystem> Subsystem;
+
+	/* Only opened for addition events on authority. Committed once all actions processed the event, including the additions queued for the frame budget */
+	TSharedPtr<FMFEA_AbilitySystemTransaction> Transaction;
+
+	/* Perform the change of the ability system component within the transaction of this event, if any */
+	void ExecuteInTransaction(FMFEA_AbilitySystemTransaction::EPhase Phase, TFunction<void()>&& Change) const;
+
+	/* Also returns actors pending kill, since removal events can be sent while the actor is being destroyed */
+	AActor* GetActor() const
+	{
+		return Actor.Get(true);
+	}
+
+	UAbilitySystemComponent* GetAbilitySystemComponent() const
+	{
+		return AbilitySystemComponent.Get();
+	}
+
+	bool IsAdditionEvent() const
+	{
+		return EventName == UGameFrameworkComponentManager::NAME_ExtensionAdded || EventName == UGameFrameworkComponentManager::NAME_GameActorReady;
+	}
+
+	bool IsRemovalEvent() const
+	{
+		return EventName == UGameFrameworkComponentManager::NAME_ExtensionRemoved || EventName == UGameFrameworkComponentManager::NAME_ReceiverRemoved;
+	}
+};
+
+/* Keeps the action registered to the extension subsystem while alive */
+struct FMFEA_ExtensionRequestHandle
+{
+	FMFEA_ExtensionRequestHandle(UMFEA_ExtensionSubsystem* InSubsystem, const FSoftObjectPath& InReceiverClass, UGameFeatureAction_WorldActionBase* InAction);
+	~FMFEA_ExtensionRequestHandle();
+
+private:
+	TWeakObjectPtr<UMFEA_ExtensionSubsystem> Subsystem;
+	FSoftObjectPath ReceiverClass;
+	TWeakObjectPtr<UGameFeatureAction_WorldActionBase> Action;
+};
+
+using FMFEA_ExtensionRequestHandlePtr = TSharedPtr<FMFEA_ExtensionRequestHandle>;
+
+/**
+ * Registers a single extension handler in the component manager for each receiver class and dispatches the events to all actions registered to the class
+ */
+UCLASS(MinimalAPI, NotBlueprintType)
+class UMFEA_ExtensionSubsystem final : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+	friend struct FMFEA_ExtensionRequestHandle;
+
+public:
+	virtual void Deinitialize() override;
+
+	/* Register the action to receive the extension events of the given class. Actors already extended by other actions are sent to the new action right away */
+	FMFEA_ExtensionRequestHandlePtr AddExtensionHandler(const TSoftClassPtr<AActor>& ReceiverClass, UGameFeatureAction_WorldActionBase* Action);
+
+	/* Number of receiver classes with at least one registered action */
+	int32 GetNumReceiverClasses() const;
+
+	/* Additions are spread across frames if the extension frame budget is set, or if older additions are still waiting for it */
+	bool ShouldDeferExtensionWork() const;
+
+	/* Queue the addition of the action to the actor of the context. Additions queued by all actions during the same event are processed together,
+	 * with a single budget shared by all actions */
+	void QueueExtensionWork(UGameFeatureAction_WorldActionBase* Action, const FMFEA_ExtensionContext& Context, uint32 Serial);
+
+	/* Number of extension events waiting for the frame budget */
+	MODULARFEATURES_EXTRAACTIONS_API int32 GetPendingExtensionWorkNum() const;
+
+	/* Request the replication of the ability system component at the end of the frame, once for all changes made during the frame.
+	 * Replicates immediately if the component has no game instance, e.g. during shutdown */
+	static void MarkReplicationDirty(UAbilitySystemComponent* AbilitySystemComponent);
+
+	/* Queue the addition or removal of the mapping context, applied to the local player at the end of the frame with a single rebuild of its mappings.
+	 * Only the last change of each context is kept, so an addition and a removal in the same frame cancel out. Applied immediately if there's no game instance */
+	static void QueueMappingContextChange(UEnhancedInputLocalPlayerSubsystem* InputSubsystem, UInputMappingContext* MappingContext, int32 Priority,
+	                                      bool bAdd);
+
+	/* Machine-readable report of the extension events and of the registered actions, written by the console command MFEA.WriteReport */
+	MODULARFEATURES_EXTRAACTIONS_API FString MakeReport() const;
+
+	/* Reset the counters of the extension events */
+	MODULARFEATURES_EXTRAACTIONS_API void ResetReportCounters();
+
+private:
+	void RemoveExtensionHandler(const FSoftObjectPath& ReceiverClass, const UGameFeatureAction_WorldActionBase* Action);
+	void HandleActorExtension(AActor* Actor, FName EventName, FSoftObjectPath ReceiverClass);
+	void DispatchExtensionEvent(const FMFEA_ExtensionContext& Context, TConstArrayView<TWeakObjectPtr<UGameFeatureAction_WorldActionBase>> Actions);
+
+	FMFEA_ExtensionContext MakeExtensionContext(AActor* Actor, FName EventName);
+
+	bool DrainExtensionWork(float DeltaTime);
+	void ResetExtensionWork();
+
+	void RequestEndFrameFlush();
+	void FlushEndFrame();
+	void FlushReplication();
+	void FlushMappingContexts();
+
+	struct FClassExtension
+	{
+		TSharedPtr<FComponentRequestHandle> ComponentRequest;
+		TArray<TWeakObjectPtr<UGameFeatureAction_WorldActionBase>> Actions;
+
+		/* Actors that received an addition event and were not removed yet */
+		TMap<FObjectKey, TWeakObjectPtr<AActor>> Receivers;
+
+		/* Counters of the events dispatched to the actions, including the time spent by all actions */
+		uint64 NumAdditionEvents = 0;
+		uint64 NumRemovalEvents = 0;
+		double TotalDispatchTime = 0.0;
+		double PeakDispatchTime = 0.0;
+	};
+
+	TMap<FSoftObjectPath, FClassExtension> ClassExtensions;
+
+	struct FQueuedAction
+	{
+		TWeakObjectPtr<UGameFeatureAction_WorldActionBase> Action;
+		uint32 Serial = 0;
+	};
+
+	struct FExtensionWork
+	{
+		FMFEA_ExtensionContext Context;
+		TArray<FQueuedAction, TInlineAllocator<8>> Actions;
+	};
+
+	/* Pending extension events, processed in order from the head. The processed jobs are only compacted once they take most of the queue */
+	TArray<FExtensionWork> PendingExtensionWork;
+	int32 ExtensionWorkHead = 0;
+
+	/* Job of the event being dispatched, to group the additions queued by all actions during the dispatch */
+	const FMFEA_ExtensionContext* DispatchingContext = nullptr;
+	int32 DispatchingWorkIndex = INDEX_NONE;
+
+	double LastExtensionDrainTime = 0.0;
+	FTSTicker::FDelegateHandle ExtensionWorkTickerHandle;
+
+	/* Ability system components changed during this frame, replicated once at the end of the frame */
+	TSet<TWeakObjectPtr<UAbilitySystemComponent>> DirtyAbilitySystemComponents;
+
+	struct FMappingContextChange
+	{
+		TWeakObjectPtr<UInputMappingContext> MappingContext;
+		int32 Priority = 0;
+		bool bAdd = true;
+	};
+
+	/* Mapping context changes of each local player made during this frame */
+	TMap<TWeakObjectPtr<UEnhancedInputLocalPlayerSubsystem>, TArray<FMappingContextChange>> PendingMappingContextChanges;
+
+	/* Only bound while there are pending changes */
+	FDelegateHandle EndFrameHandle;
+};
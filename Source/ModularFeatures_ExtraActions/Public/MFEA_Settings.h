@@ -36,6 +36,9 @@ public:
 	explicit UMFEA_Settings(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 	static const UMFEA_Settings* Get();
 
+	/* Get the InputID associated to the value name of the InputID Enumeration - Returns INDEX_NONE if not found or if AbilityBindingMode is not set to InputID */
+	int32 GetInputIDByName(FName ValueName) const;
+
 private:
 	/* Work in Progress: If true, will auto bind the ability input directly using the given Input Action. Will be added in a next update. */
 	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Settings", Meta = (DisplayName = "Enable Ability Auto Binding", EditCondition = "false"))
@@ -60,6 +63,14 @@ public:
 	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Settings", Meta = (DisplayName = "Default Input Binding Owner"))
 	EInputBindingOwner InputBindingOwner;
 
+	/* Maximum time in milliseconds spent extending actors per frame, shared by all actions - Set to 0 to extend all actors in the same frame */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Performance", Meta = (DisplayName = "Extension Frame Budget (ms)", ClampMin = "0", Units = "Milliseconds"))
+	float ExtensionFrameBudget;
+
+	/* Number of events kept in memory and written by MFEA.DumpEvents or when the engine crashes - Set to 0 to disable the event recording */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Diagnostics", Meta = (ClampMin = "0", ConfigRestartRequired = true))
+	int32 EventLogCapacity;
+
 protected:
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
@@ -69,4 +80,12 @@ protected:
 
 private:
 	void ToggleInternalLogs();
+
+	/* Load the InputID Enumeration and map all of its value names to their values */
+	void BuildInputIDTable() const;
+	void InvalidateInputIDTable() const;
+
+	/* Built on the first lookup and kept until the InputID settings change */
+	mutable TMap<FName, int32> InputIDTable;
+	mutable bool bInputIDTableBuilt = false;
 };
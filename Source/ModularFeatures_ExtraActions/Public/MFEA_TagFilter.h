@@ -0,0 +1,62 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+class AActor;
+
+/**
+ *
+ */
+
+/* Set of actor tags stored as bits, each tag name being interned to a global index the first time an action requires it */
+struct FMFEA_TagSignature
+{
+	/* Build the signature of the actor tags - Tags that are not required by any action are ignored */
+	static FMFEA_TagSignature MakeFromActor(const AActor* Actor);
+
+	void AddTagIndex(int32 TagIndex);
+
+	bool ContainsAll(const FMFEA_TagSignature& Other) const
+	{
+		for (int32 WordIndex = 0; WordIndex < Other.Words.Num(); ++WordIndex)
+		{
+			const uint64 Word = Words.IsValidIndex(WordIndex) ? Words[WordIndex] : 0;
+			if ((Word & Other.Words[WordIndex]) != Other.Words[WordIndex])
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool IsEmpty() const
+	{
+		return Words.IsEmpty();
+	}
+
+private:
+	TArray<uint64, TInlineAllocator<2>> Words;
+};
+
+/* Tags required on the target, compiled once per activation */
+struct FMFEA_TagFilter
+{
+	void Compile(const TArray<FName>& RequiredTags);
+	void Reset();
+
+	bool Matches(const FMFEA_TagSignature& ActorTags) const
+	{
+		return !bNeverMatches && ActorTags.ContainsAll(RequiredSignature);
+	}
+
+private:
+	FMFEA_TagSignature RequiredSignature;
+
+	/* Same as AActor::ActorHasTag: a None tag is never found on the actor */
+	bool bNeverMatches = false;
+};
@@ -0,0 +1,35 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+using UnrealBuildTool;
+
+public class ModularFeatures_ExtraActionsTests : ModuleRules
+{
+	public ModularFeatures_ExtraActionsTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+		CppStandard = CppStandardVersion.Cpp17;
+
+		PublicDependencyModuleNames.AddRange(new[]
+		{
+			"Core"
+		});
+
+		PrivateDependencyModuleNames.AddRange(new[]
+		{
+			"Engine",
+			"CoreUObject",
+			"InputCore",
+			"EnhancedInput",
+			"GameplayAbilities",
+			"GameplayTags",
+			"GameplayTasks",
+			"GameFeatures",
+			"ModularGameplay",
+			"DeveloperSettings",
+			"Json",
+			"ModularFeatures_ExtraActions"
+		});
+	}
+}
@@ -0,0 +1,416 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#include "MFEA_TestTypes.h"
+#include "MFEA_ExtensionSubsystem.h"
+#include "MFEA_Settings.h"
+#include "Actions/GameFeatureAction_AddAttribute.h"
+#include "Actions/GameFeatureAction_AddEffects.h"
+#include "Actions/GameFeatureAction_AddAbilities.h"
+#include "Actions/GameFeatureAction_AddInputs.h"
+#include "Actions/GameFeatureAction_SpawnActors.h"
+#include <GameFeaturesSubsystem.h>
+#include <Components/GameFrameworkComponentManager.h>
+#include <InputMappingContext.h>
+#include <Engine/Engine.h>
+#include <Engine/GameInstance.h>
+#include <Engine/World.h>
+#include <EngineUtils.h>
+#include <HAL/PlatformTime.h>
+#include <Misc/AutomationTest.h>
+#include <Misc/DateTime.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+#include <Dom/JsonObject.h>
+#include <Serialization/JsonReader.h>
+#include <Serialization/JsonSerializer.h>
+#include <UObject/StrongObjectPtr.h>
+#include <Runtime/Launch/Resources/Version.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MFEA_ScaleTest
+{
+	/* Time each step may wait for the actions to settle before the test fails */
+	constexpr double MaxWaitSeconds = 300.0;
+
+	struct FActionRun
+	{
+		FString Name;
+		TStrongObjectPtr<UGameFeatureAction> Action;
+
+		/* Actors extended by the action, compared to ExpectedActors after the activation and to zero after the deactivation */
+		TFunction<int32()> CountExtendedActors;
+		int32 ExpectedActors = 0;
+		bool bActive = false;
+	};
+
+	double ToMegabytes(const int64 Bytes)
+	{
+		return static_cast<double>(Bytes) / (1024.0 * 1024.0);
+	}
+}
+
+/**
+ * Spawns the pawns in a standalone game world, then activates and deactivates each action in turn and writes the time and memory of each step
+ * to the profiling directory
+ */
+class FMFEA_ScaleTestCommand final : public IAutomationLatentCommand
+{
+public:
+	FMFEA_ScaleTestCommand(FAutomationTestBase* const InTest, const int32 InNumPawns) : Test(InTest), NumPawns(InNumPawns)
+	{
+	}
+
+	virtual bool Update() override;
+
+private:
+	enum class EStep : uint8
+	{
+		Activate,
+		WaitActivation,
+		Deactivate,
+		WaitDeactivation
+	};
+
+	bool Setup();
+	void AddActions(UWorld* World);
+	void TearDown();
+
+	void BeginStep();
+	bool WaitStep(const MFEA_ScaleTest::FActionRun& Run, int32 ExpectedActors, const FString& StepName);
+
+	void Activate(MFEA_ScaleTest::FActionRun& Run);
+	void Deactivate(MFEA_ScaleTest::FActionRun& Run);
+
+	UMFEA_ExtensionSubsystem* GetExtensionSubsystem() const;
+	void WriteReport() const;
+
+	FAutomationTestBase* Test;
+	int32 NumPawns;
+
+	TStrongObjectPtr<UGameInstance> GameInstance;
+	TStrongObjectPtr<UInputMappingContext> InputMappingContext;
+	TArray<MFEA_ScaleTest::FActionRun> Runs;
+
+	int32 RunIndex = INDEX_NONE;
+	EStep Step = EStep::Activate;
+
+	double StepStartTime = 0.0;
+	int32 StepFrames = 0;
+	uint64 StepStartMemory = 0;
+
+	TSharedPtr<FJsonObject> RunReport;
+	TArray<TSharedPtr<FJsonValue>> RunReports;
+};
+
+bool FMFEA_ScaleTestCommand::Update()
+{
+	if (RunIndex == INDEX_NONE)
+	{
+		if (!Setup())
+		{
+			TearDown();
+			return true;
+		}
+
+		RunIndex = 0;
+	}
+
+	MFEA_ScaleTest::FActionRun& Run = Runs[RunIndex];
+
+	switch (Step)
+	{
+		case EStep::Activate:
+			Activate(Run);
+			Step = EStep::WaitActivation;
+			break;
+
+		case EStep::WaitActivation:
+			if (WaitStep(Run, Run.ExpectedActors, TEXT("Activation")))
+			{
+				// Keep the extension report of this action only, the counters are reset before each activation
+				if (const UMFEA_ExtensionSubsystem* const ExtensionSubsystem = GetExtensionSubsystem())
+				{
+					TSharedPtr<FJsonObject> ExtensionReport;
+					if (FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ExtensionSubsystem->MakeReport()), ExtensionReport))
+					{
+						RunReport->SetObjectField(TEXT("Extension"), ExtensionReport);
+					}
+				}
+
+				Step = EStep::Deactivate;
+			}
+			break;
+
+		case EStep::Deactivate:
+			Deactivate(Run);
+			Step = EStep::WaitDeactivation;
+			break;
+
+		case EStep::WaitDeactivation:
+			if (WaitStep(Run, 0, TEXT("Deactivation")))
+			{
+				RunReports.Add(MakeShared<FJsonValueObject>(RunReport));
+				RunReport.Reset();
+
+				Step = EStep::Activate;
+				if (!Runs.IsValidIndex(++RunIndex))
+				{
+					WriteReport();
+					TearDown();
+					return true;
+				}
+			}
+			break;
+	}
+
+	return false;
+}
+
+bool FMFEA_ScaleTestCommand::Setup()
+{
+	if (!Test->TestNotNull(TEXT("Engine"), GEngine))
+	{
+		return false;
+	}
+
+	// A standalone game instance gives us a game world and the extension subsystem without loading a map
+	GameInstance.Reset(NewObject<UGameInstance>(GEngine));
+	GameInstance->InitializeStandalone();
+
+	UWorld* const World = GameInstance->GetWorld();
+	if (!Test->TestNotNull(TEXT("World"), World) || !Test->TestNotNull(TEXT("Extension Subsystem"), GetExtensionSubsystem()))
+	{
+		return false;
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	for (int32 Iterator = 0; Iterator < NumPawns; ++Iterator)
+	{
+		AMFEA_TestPawn* const Pawn = World->SpawnActor<AMFEA_TestPawn>(SpawnParameters);
+		if (!Test->TestNotNull(TEXT("Pawn"), Pawn))
+		{
+			return false;
+		}
+
+		UGameFrameworkComponentManager::AddGameFrameworkComponentReceiver(Pawn);
+	}
+
+	AddActions(World);
+
+	return true;
+}
+
+void FMFEA_ScaleTestCommand::AddActions(UWorld* const World)
+{
+	const TSoftClassPtr<APawn> PawnClass(AMFEA_TestPawn::StaticClass());
+
+	const auto CountExtendedActors = [](const UGameFeatureAction_WorldActionBase* const Action)
+	{
+		return [Action] { return Action->GetNumExtendedActors(); };
+	};
+
+	UGameFeatureAction_AddAttribute* const AddAttribute = NewObject<UGameFeatureAction_AddAttribute>();
+	AddAttribute->TargetPawnClass = PawnClass;
+	AddAttribute->Attribute = UMFEA_TestAttributeSet::StaticClass();
+	Runs.Add({TEXT("AddAttribute"), TStrongObjectPtr<UGameFeatureAction>(AddAttribute), CountExtendedActors(AddAttribute), NumPawns});
+
+	UGameFeatureAction_AddEffects* const AddEffects = NewObject<UGameFeatureAction_AddEffects>();
+	AddEffects->TargetPawnClass = PawnClass;
+	AddEffects->Effects.AddDefaulted_GetRef().EffectClass = UMFEA_TestEffect::StaticClass();
+	Runs.Add({TEXT("AddEffects"), TStrongObjectPtr<UGameFeatureAction>(AddEffects), CountExtendedActors(AddEffects), NumPawns});
+
+	UGameFeatureAction_AddAbilities* const AddAbilities = NewObject<UGameFeatureAction_AddAbilities>();
+	AddAbilities->TargetPawnClass = PawnClass;
+	AddAbilities->Abilities.AddDefaulted_GetRef().AbilityClass = UMFEA_TestAbility::StaticClass();
+	Runs.Add({TEXT("AddAbilities"), TStrongObjectPtr<UGameFeatureAction>(AddAbilities), CountExtendedActors(AddAbilities), NumPawns});
+
+	// The test pawns have no player controller, so the inputs are only checked to leave them untouched
+	InputMappingContext.Reset(NewObject<UInputMappingContext>());
+
+	UGameFeatureAction_AddInputs* const AddInputs = NewObject<UGameFeatureAction_AddInputs>();
+	AddInputs->TargetPawnClass = PawnClass;
+	AddInputs->InputMappingContext = InputMappingContext.Get();
+	Runs.Add({TEXT("AddInputs"), TStrongObjectPtr<UGameFeatureAction>(AddInputs), CountExtendedActors(AddInputs), 0});
+
+	UGameFeatureAction_SpawnActors* const SpawnActors = NewObject<UGameFeatureAction_SpawnActors>();
+	SpawnActors->TargetLevels.Add(TSoftObjectPtr<UWorld>(World));
+	SpawnActors->SpawnSettings.Init(FActorSpawnSettings{TSoftClassPtr<AActor>(AMFEA_TestSpawnedActor::StaticClass()), FTransform::Identity}, NumPawns);
+
+	const TWeakObjectPtr<UWorld> WeakWorld(World);
+	Runs.Add({TEXT("SpawnActors"), TStrongObjectPtr<UGameFeatureAction>(SpawnActors), [WeakWorld]
+	{
+		int32 NumActors = 0;
+		if (WeakWorld.IsValid())
+		{
+			for (TActorIterator<AMFEA_TestSpawnedActor> Iterator(WeakWorld.Get()); Iterator; ++Iterator)
+			{
+				++NumActors;
+			}
+		}
+
+		return NumActors;
+	}, NumPawns});
+}
+
+void FMFEA_ScaleTestCommand::TearDown()
+{
+	for (MFEA_ScaleTest::FActionRun& Run : Runs)
+	{
+		if (Run.bActive)
+		{
+			Deactivate(Run);
+		}
+	}
+
+	Runs.Empty();
+	InputMappingContext.Reset();
+
+	if (!GameInstance.IsValid())
+	{
+		return;
+	}
+
+	UWorld* const World = GameInstance->GetWorld();
+	GameInstance->Shutdown();
+
+	if (IsValid(World))
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	GameInstance.Reset();
+}
+
+void FMFEA_ScaleTestCommand::BeginStep()
+{
+	StepStartTime = FPlatformTime::Seconds();
+	StepStartMemory = FPlatformMemory::GetStats().UsedPhysical;
+	StepFrames = 0;
+}
+
+bool FMFEA_ScaleTestCommand::WaitStep(const MFEA_ScaleTest::FActionRun& Run, const int32 ExpectedActors, const FString& StepName)
+{
+	++StepFrames;
+
+	const double ElapsedTime = FPlatformTime::Seconds() - StepStartTime;
+	const int32 NumActors = Run.CountExtendedActors();
+
+	const UMFEA_ExtensionSubsystem* const ExtensionSubsystem = GetExtensionSubsystem();
+	const bool bSettled = NumActors == ExpectedActors && (!ExtensionSubsystem || ExtensionSubsystem->GetPendingExtensionWorkNum() == 0);
+
+	if (!bSettled && ElapsedTime < MFEA_ScaleTest::MaxWaitSeconds)
+	{
+		return false;
+	}
+
+	if (!bSettled)
+	{
+		Test->AddError(FString::Printf(TEXT("%s of %s with %d pawns timed out: %d of %d actors after %.0f seconds."), *StepName, *Run.Name,
+		                               NumPawns, NumActors, ExpectedActors, ElapsedTime));
+	}
+
+	const int64 MemoryDelta = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(StepStartMemory);
+
+	RunReport->SetBoolField(StepName + TEXT("Settled"), bSettled);
+	RunReport->SetNumberField(StepName + TEXT("Ms"), ElapsedTime * 1000.0);
+	RunReport->SetNumberField(StepName + TEXT("Frames"), StepFrames);
+	RunReport->SetNumberField(StepName + TEXT("MemoryDeltaMB"), MFEA_ScaleTest::ToMegabytes(MemoryDelta));
+	RunReport->SetNumberField(StepName + TEXT("ExtendedActors"), NumActors);
+
+	return true;
+}
+
+void FMFEA_ScaleTestCommand::Activate(MFEA_ScaleTest::FActionRun& Run)
+{
+	RunReport = MakeShared<FJsonObject>();
+	RunReport->SetStringField(TEXT("Action"), Run.Name);
+	RunReport->SetNumberField(TEXT("ExpectedActors"), Run.ExpectedActors);
+
+	if (UMFEA_ExtensionSubsystem* const ExtensionSubsystem = GetExtensionSubsystem())
+	{
+		ExtensionSubsystem->ResetReportCounters();
+	}
+
+	// Restrict the action to the world of the test, the editor worlds must not be extended
+	FGameFeatureActivatingContext ActivatingContext;
+	ActivatingContext.SetRequiredWorldContextHandle(GameInstance->GetWorldContext()->ContextHandle);
+
+	BeginStep();
+	Run.Action->OnGameFeatureActivating(ActivatingContext);
+	Run.bActive = true;
+}
+
+void FMFEA_ScaleTestCommand::Deactivate(MFEA_ScaleTest::FActionRun& Run)
+{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+	FGameFeatureDeactivatingContext DeactivatingContext(TEXT(""), [](FStringView) {});
+#else
+	FGameFeatureDeactivatingContext DeactivatingContext(FSimpleDelegate::CreateLambda([] {}));
+#endif
+	DeactivatingContext.SetRequiredWorldContextHandle(GameInstance->GetWorldContext()->ContextHandle);
+
+	BeginStep();
+	Run.Action->OnGameFeatureDeactivating(DeactivatingContext);
+	Run.bActive = false;
+}
+
+UMFEA_ExtensionSubsystem* FMFEA_ScaleTestCommand::GetExtensionSubsystem() const
+{
+	return GameInstance.IsValid() ? GameInstance->GetSubsystem<UMFEA_ExtensionSubsystem>() : nullptr;
+}
+
+void FMFEA_ScaleTestCommand::WriteReport() const
+{
+	const TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetStringField(TEXT("Time"), FDateTime::UtcNow().ToIso8601());
+	Report->SetNumberField(TEXT("NumPawns"), NumPawns);
+	Report->SetNumberField(TEXT("ExtensionFrameBudget"), UMFEA_Settings::Get()->ExtensionFrameBudget);
+	Report->SetNumberField(TEXT("PeakUsedPhysicalMB"), MFEA_ScaleTest::ToMegabytes(FPlatformMemory::GetStats().PeakUsedPhysical));
+	Report->SetArrayField(TEXT("Actions"), RunReports);
+
+	FString Output;
+	FJsonSerializer::Serialize(Report, TJsonWriterFactory<>::Create(&Output));
+
+	const FString FilePath = FPaths::ProfilingDir() / TEXT("MFEA") / FString::Printf(TEXT("ScaleTest-%d.json"), NumPawns);
+	if (FFileHelper::SaveStringToFile(Output, *FilePath))
+	{
+		Test->AddInfo(FString::Printf(TEXT("Report written to %s."), *FilePath));
+	}
+	else
+	{
+		Test->AddError(FString::Printf(TEXT("Failed to write %s."), *FilePath));
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FMFEA_ScaleTest, "ModularFeatures_ExtraActions.Scale",
+                                  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+void FMFEA_ScaleTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 NumPawns : {10, 100, 1000, 5000})
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Pawns"), NumPawns));
+		OutTestCommands.Add(FString::FromInt(NumPawns));
+	}
+}
+
+bool FMFEA_ScaleTest::RunTest(const FString& Parameters)
+{
+	const int32 NumPawns = FCString::Atoi(*Parameters);
+	if (!TestTrue(TEXT("Number of pawns"), NumPawns > 0))
+	{
+		return false;
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FMFEA_ScaleTestCommand(this, NumPawns));
+
+	return true;
+}
+
+#endif
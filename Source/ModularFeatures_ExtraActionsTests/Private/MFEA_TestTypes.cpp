@@ -0,0 +1,34 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#include "MFEA_TestTypes.h"
+#include <AbilitySystemComponent.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(MFEA_TestTypes)
+#endif
+
+AMFEA_TestPawn::AMFEA_TestPawn(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	PrimaryActorTick.bCanEverTick = false;
+	AbilitySystemComponent = CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
+}
+
+UAbilitySystemComponent* AMFEA_TestPawn::GetAbilitySystemComponent() const
+{
+	return AbilitySystemComponent;
+}
+
+UMFEA_TestEffect::UMFEA_TestEffect(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	DurationPolicy = EGameplayEffectDurationType::Infinite;
+
+	FGameplayModifierInfo Modifier;
+	Modifier.Attribute = FGameplayAttribute(FindFieldChecked<FProperty>(UMFEA_TestAttributeSet::StaticClass(),
+	                                                                    GET_MEMBER_NAME_CHECKED(UMFEA_TestAttributeSet, Health)));
+	Modifier.ModifierOp = EGameplayModOp::Additive;
+	Modifier.ModifierMagnitude = FScalableFloat(1.f);
+
+	Modifiers.Add(Modifier);
+}
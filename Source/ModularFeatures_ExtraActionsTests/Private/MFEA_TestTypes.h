@@ -0,0 +1,76 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <GameFramework/Pawn.h>
+#include <AbilitySystemInterface.h>
+#include <AttributeSet.h>
+#include <GameplayEffect.h>
+#include <Abilities/GameplayAbility.h>
+#include "MFEA_TestTypes.generated.h"
+
+class UAbilitySystemComponent;
+
+/**
+ * Pawn extended by the actions in the automation tests
+ */
+UCLASS(NotBlueprintable, NotPlaceable, HideDropdown)
+class AMFEA_TestPawn final : public APawn, public IAbilitySystemInterface
+{
+	GENERATED_BODY()
+
+public:
+	explicit AMFEA_TestPawn(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
+
+private:
+	UPROPERTY()
+	UAbilitySystemComponent* AbilitySystemComponent;
+};
+
+/**
+ * Attribute set added by the automation tests
+ */
+UCLASS(NotBlueprintable, HideDropdown)
+class UMFEA_TestAttributeSet final : public UAttributeSet
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	FGameplayAttributeData Health;
+};
+
+/**
+ * Infinite effect modifying the test attribute, so each application is kept active until the action removes it
+ */
+UCLASS(NotBlueprintable, HideDropdown)
+class UMFEA_TestEffect final : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	explicit UMFEA_TestEffect(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+};
+
+/**
+ * Ability given by the automation tests
+ */
+UCLASS(NotBlueprintable, HideDropdown)
+class UMFEA_TestAbility final : public UGameplayAbility
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Actor spawned by the automation tests
+ */
+UCLASS(NotBlueprintable, NotPlaceable, HideDropdown)
+class AMFEA_TestSpawnedActor final : public AActor
+{
+	GENERATED_BODY()
+};
@@ -0,0 +1,7 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
+
+#include <Modules/ModuleManager.h>
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, ModularFeatures_ExtraActionsTests);
@@ -1,9 +0,0 @@
-﻿// Author: Lucas Vilas-Boas
-// Year: 2022
-// Repo: https://github.com/lucoiso/UEModularFeatures_ExtraActions
-
-#include "Interfaces/MFEA_AbilityInputBinding.h"
-
-#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
-#include UE_INLINE_GENERATED_CPP_BY_NAME(MFEA_AbilityInputBinding)
-#endif